@@ -0,0 +1,67 @@
+#include "AIScheduler.h"
+#include "Game.h"
+#include "FileMenager.h"
+#include "QualityGovernor.h"
+#include <cmath>
+
+const uint32_t staggerSlots = 16;
+const float turnRate = 12.0f;
+
+Blackboard AIScheduler::blackboard;
+atomic<uint32_t> AIScheduler::slots = 0;
+
+AIClock::AIClock() : slot(AIScheduler::takeSlot()), random(uint32_t(rand())) {}
+
+const float AIClock::getRandom(const float& min, const float& max)
+{
+	return uniform_real_distribution<float>(min, max)(random);
+}
+
+void AIScheduler::beginFrame(const float& deltaTime)
+{
+	const auto player = Game::doesEntityExist(TYPE_PLAYER);
+
+	blackboard.hasPlayer = player != nullptr;
+	if (player) blackboard.playerPosition = player->position;
+
+	if (!Game::freeze.isEffectActive()) blackboard.time += deltaTime;
+	blackboard.tick++;
+}
+
+const Blackboard& AIScheduler::getBlackboard()
+{
+	return blackboard;
+}
+
+bool AIScheduler::shouldThink(AIClock& clock)
+{
+	const auto period = getPeriod();
+
+	if (!clock.started) {
+		clock.nextThink = blackboard.time + period * float(clock.slot % staggerSlots) / staggerSlots;
+		clock.started = true;
+	}
+
+	if (blackboard.time < clock.nextThink) return false;
+
+	// A long frame doesn't make an entity catch up with several thinks in a row
+	clock.nextThink = max(clock.nextThink + period, blackboard.time);
+	return true;
+}
+
+const uint32_t AIScheduler::takeSlot()
+{
+	return slots++;
+}
+
+const float AIScheduler::getPeriod()
+{
+	return QualityGovernor::getSettings().aiTickInterval / max(FileMenager::enemiesData.ai_think_rate, 1.0f);
+}
+
+const float AIScheduler::turnTowards(const float& angle, const float& target, const float& deltaTime)
+{
+	const auto difference = remainder(target - angle, 360.0f);
+
+	return angle + difference * min(deltaTime * turnRate, 1.0f);
+}
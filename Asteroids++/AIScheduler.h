@@ -0,0 +1,50 @@
+#pragma once
+#ifndef AISCHEDULER_H
+#define AISCHEDULER_H
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <random>
+#include <cstdint>
+
+using namespace sf;
+using namespace std;
+
+// What every AI reads during a frame, filled once before the think phase
+struct Blackboard {
+	Vector2f playerPosition;
+	bool hasPlayer = false;
+	float time = 0.0f;
+	uint64_t tick = 0;
+};
+
+// Made on the main thread when the entity spawns, so its phase and random numbers don't depend on which worker thinks for it
+struct AIClock {
+	AIClock();
+
+	float nextThink = 0.0f;
+	bool started = false;
+	uint32_t slot;
+	minstd_rand random;
+
+	const float getRandom(const float& min, const float& max);
+};
+
+// AI decides at a fixed rate and moves every frame in between, each entity gets its own phase so the thinking is spread evenly
+class AIScheduler {
+public:
+	static void beginFrame(const float& deltaTime);
+
+	static const Blackboard& getBlackboard();
+	static bool shouldThink(AIClock& clock);
+	static const float getPeriod();
+
+	static const float turnTowards(const float& angle, const float& target, const float& deltaTime);
+
+	static const uint32_t takeSlot();
+private:
+	static Blackboard blackboard;
+	static atomic<uint32_t> slots;
+};
+
+#endif
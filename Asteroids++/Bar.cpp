@@ -62,7 +62,7 @@ void Bar::render()
     bar.setFillColor(fillColor);
 }
 
-void Bar::draw(RenderWindow& window) const {
+void Bar::draw(RenderList& window) const {
     window.draw(outline);
     window.draw(bar);
     window.draw(spriteInfo.sprite);
@@ -5,6 +5,7 @@
 #include <SFML/Graphics.hpp>
 #include <iostream>
 #include "SpriteData.h"
+#include "RenderList.h"
 
 using namespace sf;
 using namespace std;
@@ -38,7 +39,7 @@ public:
     void updateValue(const float& newValue);
 
     void render();
-    void draw(RenderWindow& window) const;
+    void draw(RenderList& window) const;
 
     void updatePosition(const Vector2f& position);
 };
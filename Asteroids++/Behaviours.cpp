@@ -0,0 +1,198 @@
+#include "Behaviours.h"
+#include "Entity.h"
+#include "AIScheduler.h"
+#include "Timers.h"
+#include <exception>
+
+// How often a behaviour waiting for the player checks the distance again
+const float rangeCheckInterval = 0.1f;
+const size_t blocksPerChunk = 64;
+
+vector<void*> BehaviourPool::freeBlocks;
+vector<unique_ptr<char[]>> BehaviourPool::chunks;
+
+uint64_t Behaviours::order = 0;
+priority_queue<Wakeup, vector<Wakeup>, greater<Wakeup>> Behaviours::timers;
+vector<BehaviourTask::Handle> Behaviours::nextTick;
+vector<Wakeup> Behaviours::due;
+unordered_set<void*> Behaviours::parked;
+
+BehaviourTask BehaviourTask::promise_type::get_return_object()
+{
+	return BehaviourTask{ Handle::from_promise(*this) };
+}
+
+void BehaviourTask::promise_type::unhandled_exception()
+{
+	terminate();
+}
+
+void* BehaviourTask::promise_type::operator new(size_t size)
+{
+	return BehaviourPool::allocate(size);
+}
+
+void BehaviourTask::promise_type::operator delete(void* frame, size_t size)
+{
+	BehaviourPool::release(frame, size);
+}
+
+void* BehaviourPool::allocate(const size_t& size)
+{
+	if (size > blockSize) return ::operator new(size);
+
+	if (freeBlocks.empty()) {
+		chunks.push_back(make_unique<char[]>(blockSize * blocksPerChunk));
+
+		for (size_t block = 0; block < blocksPerChunk; block++) freeBlocks.push_back(chunks.back().get() + block * blockSize);
+	}
+
+	const auto frame = freeBlocks.back();
+	freeBlocks.pop_back();
+
+	return frame;
+}
+
+void BehaviourPool::release(void* frame, const size_t& size)
+{
+	if (size > blockSize) {
+		::operator delete(frame);
+		return;
+	}
+
+	freeBlocks.push_back(frame);
+}
+
+bool Wakeup::operator>(const Wakeup& other) const
+{
+	return time != other.time ? time > other.time : order > other.order;
+}
+
+void Behaviours::start(Entity* owner, BehaviourTask task)
+{
+	task.handle.promise().owner = owner;
+
+	wakeNextTick(task.handle);
+}
+
+void Behaviours::update()
+{
+	const auto time = Timers::now(GameClock::WORLD);
+
+	// Everything due is taken out first, so a behaviour that waits again while resuming is picked up next frame at the earliest
+	auto ticking = move(nextTick);
+	nextTick.clear();
+
+	due.clear();
+	while (!timers.empty() && timers.top().time <= time) {
+		due.push_back(timers.top());
+		timers.pop();
+	}
+
+	// An owner can be switched off without raising what it waits on, its behaviour is dropped here instead
+	erase_if(parked, [](void* frame) {
+		const auto handle = BehaviourTask::Handle::from_address(frame);
+		if (handle.promise().owner->isActive()) return false;
+
+		handle.destroy();
+		return true;
+	});
+
+	for (const auto handle : ticking) resume(handle);
+
+	for (const auto& wakeup : due) {
+		const auto owner = wakeup.handle.promise().owner;
+
+		if (wakeup.range > 0.0f && owner->isActive() && !isPlayerInRange(owner, wakeup.range)) {
+			wake(wakeup.handle, rangeCheckInterval, wakeup.range);
+			continue;
+		}
+
+		resume(wakeup.handle);
+	}
+}
+
+void Behaviours::clear()
+{
+	while (!timers.empty()) {
+		timers.top().handle.destroy();
+		timers.pop();
+	}
+
+	for (const auto handle : nextTick) handle.destroy();
+	nextTick.clear();
+
+	for (const auto frame : parked) BehaviourTask::Handle::from_address(frame).destroy();
+	parked.clear();
+}
+
+void Behaviours::wake(BehaviourTask::Handle handle, const float& delay, const float& range)
+{
+	timers.push({ Timers::now(GameClock::WORLD) + delay, order++, handle, range });
+}
+
+void Behaviours::wakeNextTick(BehaviourTask::Handle handle)
+{
+	nextTick.push_back(handle);
+}
+
+void Behaviours::park(BehaviourTask::Handle handle)
+{
+	parked.insert(handle.address());
+}
+
+void Behaviours::unpark(BehaviourTask::Handle handle)
+{
+	if (parked.erase(handle.address())) wakeNextTick(handle);
+}
+
+void BehaviourSignal::raise()
+{
+	if (!waiting) return;
+
+	Behaviours::unpark(waiting);
+	waiting = nullptr;
+}
+
+void Behaviours::resume(BehaviourTask::Handle handle)
+{
+	// Enemies are switched off rather than deleted, so the owner can still be asked before dropping its behaviour
+	if (!handle.promise().owner->isActive()) {
+		handle.destroy();
+		return;
+	}
+
+	handle.resume();
+
+	if (handle.done()) handle.destroy();
+}
+
+const bool Behaviours::isPlayerInRange(const Entity* owner, const float& range)
+{
+	const auto& blackboard = AIScheduler::getBlackboard();
+
+	if (!blackboard.hasPlayer) return false;
+
+	const auto offset = blackboard.playerPosition - owner->position;
+	return offset.x * offset.x + offset.y * offset.y <= range * range;
+}
+
+WaitSeconds behaviour::seconds(const float& duration)
+{
+	return { duration };
+}
+
+WaitPlayerInRange behaviour::untilPlayerInRange(const float& range)
+{
+	return { range };
+}
+
+WaitSignal behaviour::until(BehaviourSignal& signal)
+{
+	return { signal };
+}
+
+WaitTick behaviour::everyTick()
+{
+	return { };
+}
@@ -0,0 +1,128 @@
+#pragma once
+#ifndef BEHAVIOURS_H
+#define BEHAVIOURS_H
+
+#include <SFML/Graphics.hpp>
+#include <coroutine>
+#include <vector>
+#include <queue>
+#include <unordered_set>
+#include <memory>
+#include <cstdint>
+
+using namespace sf;
+using namespace std;
+
+class Entity;
+
+// Coroutine an entity runs its attack pattern in, frames come from a pool and the scheduler owns them once started
+struct BehaviourTask {
+	struct promise_type {
+		Entity* owner = nullptr;
+
+		BehaviourTask get_return_object();
+		suspend_always initial_suspend() noexcept { return {}; }
+		suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception();
+
+		static void* operator new(size_t size);
+		static void operator delete(void* frame, size_t size);
+	};
+
+	using Handle = coroutine_handle<promise_type>;
+
+	Handle handle;
+};
+
+// Fixed size blocks for coroutine frames, bigger frames fall back to the heap
+class BehaviourPool {
+public:
+	static const size_t blockSize = 512;
+
+	static void* allocate(const size_t& size);
+	static void release(void* frame, const size_t& size);
+private:
+	static vector<void*> freeBlocks;
+	static vector<unique_ptr<char[]>> chunks;
+};
+
+struct Wakeup {
+	double time;
+	uint64_t order;
+	BehaviourTask::Handle handle;
+	float range;
+
+	bool operator>(const Wakeup& other) const;
+};
+
+// Resumes only the behaviours whose wake time has passed, on the WORLD clock so they stop with everything else
+class Behaviours {
+public:
+	static void start(Entity* owner, BehaviourTask task);
+	static void update();
+	static void clear();
+
+	static void wake(BehaviourTask::Handle handle, const float& delay, const float& range);
+	static void wakeNextTick(BehaviourTask::Handle handle);
+
+	static void park(BehaviourTask::Handle handle);
+	static void unpark(BehaviourTask::Handle handle);
+
+private:
+	static void resume(BehaviourTask::Handle handle);
+	static const bool isPlayerInRange(const Entity* owner, const float& range);
+
+	static uint64_t order;
+	static priority_queue<Wakeup, vector<Wakeup>, greater<Wakeup>> timers;
+	static vector<BehaviourTask::Handle> nextTick;
+	static vector<Wakeup> due;
+	static unordered_set<void*> parked;
+};
+
+// A behaviour waiting on a signal isn't looked at again until its owner raises it
+struct BehaviourSignal {
+	BehaviourTask::Handle waiting;
+
+	void raise();
+};
+
+struct WaitSeconds {
+	float duration;
+
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(BehaviourTask::Handle handle) const { Behaviours::wake(handle, duration, 0.0f); }
+	void await_resume() const noexcept {}
+};
+
+struct WaitPlayerInRange {
+	float range;
+
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(BehaviourTask::Handle handle) const { Behaviours::wake(handle, 0.0f, range); }
+	void await_resume() const noexcept {}
+};
+
+struct WaitSignal {
+	BehaviourSignal& signal;
+
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(BehaviourTask::Handle handle) const { signal.waiting = handle; Behaviours::park(handle); }
+	void await_resume() const noexcept {}
+};
+
+struct WaitTick {
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(BehaviourTask::Handle handle) const { Behaviours::wakeNextTick(handle); }
+	void await_resume() const noexcept {}
+};
+
+// Named apart from sf::seconds, which is in scope everywhere
+namespace behaviour {
+	WaitSeconds seconds(const float& duration);
+	WaitPlayerInRange untilPlayerInRange(const float& range);
+	WaitSignal until(BehaviourSignal& signal);
+	WaitTick everyTick();
+}
+
+#endif
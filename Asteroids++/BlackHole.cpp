@@ -1,5 +1,9 @@
 #include "BlackHole.h"
 #include "Pickup.h"
+#include "Projectiles.h"
+#include "Gravity.h"
+#include "Shockwaves.h"
+#include "StatusEffects.h"
 
 BlackHole::BlackHole() : Enemy(Player::playerStats.bulletDamage * 10.0f, 0.0f, getSprite(Sprites::BLACKHOLE))
 {
@@ -9,9 +13,11 @@ BlackHole::BlackHole() : Enemy(Player::playerStats.bulletDamage * 10.0f, 0.0f, g
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 
 	drawHitboxes();
+
+	setLayer(LAYER_BLACKHOLE);
 }
 
-void BlackHole::render(RenderWindow& window)
+void BlackHole::render(RenderList& window)
 {
 	Enemy::render(window);
 }
@@ -24,39 +30,72 @@ void BlackHole::update(float deltaTime)
 		 
 	setSpriteFullCycle(deltaTime);
 
+	// Other black holes pull this one in until they touch and merge, its own mass cancels out
+	velocity += Gravity::getAcceleration(position) * deltaTime;
+	position += velocity * deltaTime;
+
 	collisionDetection();
 }
 
 void BlackHole::collisionDetection()
 {
-	Game::foreachEntity([&](Entity* entity) {
-		if (entity != this && !Game::isEntityInsideGruop(entity, Enemy::blackHoleGroup)) {
+	vector<Contact> contacts;
 
-			if (physics::intersects(this->position, radius, entity->position, entity->radius)) {
-				entity->startSpiraling(this);
-			}
-		}
+	Game::foreachEntity([&](Entity* entity) {
+		if (entity != this && collidesWith(entity) && physics::intersects(position, radius, entity->position, entity->radius)) CollisionMatrix::report(this, entity, contacts);
 	});
+
+	CollisionMatrix::submit(contacts);
 }
 
 void BlackHole::devour(Entity* entity) {
-	size += entity->size * FileMenager::enemiesData.enemy_blackhole_increse_size;
+	grow(entity->size);
+	entity->spiraling = false;
+
+	Game::replaceEntity(entity, new Explosion(entity->position, entity->size));
+}
+
+void BlackHole::absorb(const Vector2f& position, const float& size) {
+	grow(size);
+
+	Game::addEntity(new Explosion(position, size));
+}
+
+void BlackHole::merge(BlackHole* other) {
+	// Areas add up, and the momentum is kept so the merged hole keeps drifting the way the pair was
+	const auto total = size + other->size;
+	velocity = (velocity * size + other->velocity * other->size) / total;
+	position = (position * size + other->position * other->size) / total;
+
+	resize(sqrt(size * size + other->size * other->size));
+	increaseHealth(other->getHealth());
+
+	Game::replaceEntity(other, new Explosion(other->position, other->size));
+
+	StatusEffects::flash(this, Color::Green);
+}
+
+void BlackHole::grow(const float& amount) {
+	if (size >= FileMenager::enemiesData.enemy_blackhole_max_size) return;
+
+	resize(size + amount * FileMenager::enemiesData.enemy_blackhole_increse_size);
 	increaseHealth(Player::playerStats.bulletDamage * 3.0f);
 
+	StatusEffects::flash(this, Color::Green);
+}
+
+void BlackHole::resize(const float& newSize) {
+	size = min(newSize, FileMenager::enemiesData.enemy_blackhole_max_size);
 	radius = size / 2.0f;
-	entity->spiraling = false;
 
 	this->scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 	this->drawHitboxes();
-
-	Bullet::damageEnemy(this, true, Color::Green);
-
-	Game::replaceEntity(entity, new Explosion(entity->position, entity->size));
 }
 
 void BlackHole::destroy()
 {
 	Game::replaceEntity(this, new Explosion(position, radius));
+	Shockwaves::emit(position, size * 3, 400.0f, Player::playerStats.bulletDamage * 5.0f);
 
 	Score::addScore(500);
 	SoundData::play(Sounds::EXPLOSION);
@@ -13,14 +13,19 @@ class BlackHole : public Enemy
 public:
 	BlackHole();
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void devour(Entity* entity);
+	void absorb(const Vector2f& position, const float& size);
+	void merge(BlackHole* other);
 	void destroy() override;
 
 private:
+	void grow(const float& amount);
+	void resize(const float& newSize);
 
+	Vector2f velocity;
 };
 
 #endif
\ No newline at end of file
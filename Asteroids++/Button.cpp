@@ -18,7 +18,7 @@ TextField& Button::getText()
 	return text;
 }
 
-void Button::draw(RenderWindow& window) const
+void Button::draw(RenderList& window) const
 {
 	window.draw(fill);
 	window.draw(spriteInfo.sprite);
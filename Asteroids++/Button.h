@@ -7,6 +7,7 @@
 #include <iostream>
 #include "SpriteData.h"
 #include "TextField.h"
+#include "RenderList.h"
 
 using namespace sf;
 using namespace std;
@@ -19,7 +20,7 @@ public:
 	void setFillColor(const Color& color);
 	TextField& getText();
 
-	void draw(RenderWindow& window) const;
+	void draw(RenderList& window) const;
 
 	void initFillRect(const Vector2f& position);
 
@@ -0,0 +1,138 @@
+#include "CollisionMatrix.h"
+#include "Entity.h"
+#include "Enemy.h"
+#include "BlackHole.h"
+#include "Pickup.h"
+#include "Player.h"
+#include "Physics.h"
+#include "ContactSolver.h"
+#include <bit>
+#include <set>
+
+static void bounce(span<const Contact> contacts)
+{
+	ContactSolver::solve(contacts);
+}
+
+static void pullIn(span<const Contact> contacts)
+{
+	for (const auto& contact : contacts) contact.other->startSpiraling(static_cast<BlackHole*>(contact.entity));
+}
+
+static void collect(span<const Contact> contacts)
+{
+	for (const auto& contact : contacts) static_cast<Pickup*>(contact.entity)->collect();
+}
+
+static void crash(span<const Contact> contacts)
+{
+	for (const auto& contact : contacts) static_cast<Player*>(contact.entity)->destroy();
+}
+
+const vector<CollisionRule> CollisionMatrix::rules = {
+	{ LAYER_ASTEROID, LAYER_ASTEROID, ContactKind::BOUNCE },
+	{ LAYER_BLACKHOLE, LAYER_PLAYER | LAYER_ASTEROID | LAYER_ENEMY | LAYER_PICKUP | LAYER_EFFECT, ContactKind::PULL_IN },
+	{ LAYER_PICKUP, LAYER_PLAYER, ContactKind::COLLECT },
+	{ LAYER_PLAYER, LAYER_ENEMIES, ContactKind::CRASH },
+	{ LAYER_PLAYER_BULLET, LAYER_ENEMIES, ContactKind::NONE },
+	{ LAYER_ENEMY_BULLET, LAYER_PLAYER | LAYER_BLACKHOLE, ContactKind::NONE }
+};
+
+const array<ContactHandler, static_cast<size_t>(ContactKind::COUNT)> CollisionMatrix::handlers = { bounce, pullIn, collect, crash };
+
+array<uint16_t, LAYER_COUNT> CollisionMatrix::masks{};
+array<array<ContactKind, LAYER_COUNT>, LAYER_COUNT> CollisionMatrix::kinds{};
+bool CollisionMatrix::built = false;
+
+vector<Contact> CollisionMatrix::queue;
+mutex CollisionMatrix::queueMutex;
+
+const uint16_t CollisionMatrix::getMask(const uint16_t& layer)
+{
+	if (!built) build();
+
+	uint16_t mask = LAYER_NONE;
+
+	for (auto bits = layer; bits; bits &= bits - 1) mask |= masks[countr_zero(bits)];
+
+	return mask;
+}
+
+void CollisionMatrix::report(Entity* entity, Entity* other, vector<Contact>& contacts)
+{
+	const auto kind = kinds[countr_zero(entity->layer)][countr_zero(other->layer)];
+	if (kind == ContactKind::NONE) return;
+
+	const auto normal = physics::normalize(other->position - entity->position);
+
+	contacts.push_back({ entity, other, entity->position + normal * entity->radius, normal, kind });
+}
+
+void CollisionMatrix::submit(const vector<Contact>& contacts)
+{
+	if (contacts.empty()) return;
+
+	lock_guard<mutex> lock(queueMutex);
+	queue.insert(queue.end(), contacts.begin(), contacts.end());
+}
+
+// Runs each kind as one batch, keeping report order inside a kind and dropping contacts that repeat one already seen.
+// The queue is taken out under the lock so a handler can report again, what it submits waits for the next dispatch
+void CollisionMatrix::dispatch()
+{
+	vector<Contact> pending;
+
+	{
+		lock_guard<mutex> lock(queueMutex);
+		pending.swap(queue);
+	}
+
+	ranges::stable_sort(pending, [](const Contact& a, const Contact& b) { return a.kind < b.kind; });
+
+	vector<Contact> batch;
+	set<pair<const Entity*, const Entity*>> seen;
+
+	for (size_t begin = 0; begin < pending.size();) {
+		const auto kind = pending[begin].kind;
+
+		batch.clear();
+		seen.clear();
+
+		auto end = begin;
+		for (; end < pending.size() && pending[end].kind == kind; end++)
+			if (seen.insert(getKey(pending[end])).second) batch.push_back(pending[end]);
+
+		handlers[static_cast<size_t>(kind)](batch);
+		begin = end;
+	}
+}
+
+void CollisionMatrix::build()
+{
+	for (auto& row : kinds) row.fill(ContactKind::NONE);
+
+	for (const auto& rule : rules) {
+		for (auto first = rule.first; first; first &= first - 1) {
+			const auto layer = countr_zero(first);
+			masks[layer] |= rule.second;
+
+			for (auto second = rule.second; second; second &= second - 1) kinds[layer][countr_zero(second)] = rule.kind;
+		}
+	}
+
+	built = true;
+}
+
+// Bounces are resolved once per pair, an entity is pulled by one black hole, pickups and the player react once a frame
+const pair<const Entity*, const Entity*> CollisionMatrix::getKey(const Contact& contact)
+{
+	switch (contact.kind)
+	{
+	case ContactKind::BOUNCE:
+		return minmax<const Entity*>(contact.entity, contact.other);
+	case ContactKind::PULL_IN:
+		return { contact.other, nullptr };
+	default:
+		return { contact.entity, nullptr };
+	}
+}
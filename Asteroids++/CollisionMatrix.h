@@ -0,0 +1,83 @@
+#pragma once
+#ifndef COLLISIONMATRIX_H
+#define COLLISIONMATRIX_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+#include <span>
+#include <mutex>
+#include <cstdint>
+
+using namespace sf;
+using namespace std;
+
+class Entity;
+
+enum CollisionLayer : uint16_t {
+	LAYER_NONE = 0,
+	LAYER_PLAYER = 1 << 0,
+	LAYER_ASTEROID = 1 << 1,
+	LAYER_ENEMY = 1 << 2,
+	LAYER_HEAVY_ENEMY = 1 << 3,
+	LAYER_BLACKHOLE = 1 << 4,
+	LAYER_PICKUP = 1 << 5,
+	LAYER_EFFECT = 1 << 6,
+	LAYER_PLAYER_BULLET = 1 << 7,
+	LAYER_ENEMY_BULLET = 1 << 8,
+	LAYER_COUNT = 9
+};
+
+const uint16_t LAYER_ENEMIES = LAYER_ASTEROID | LAYER_ENEMY | LAYER_HEAVY_ENEMY | LAYER_BLACKHOLE;
+
+enum class ContactKind : uint8_t {
+	BOUNCE,
+	PULL_IN,
+	COLLECT,
+	CRASH,
+	COUNT,
+	NONE = COUNT
+};
+
+// other is null when the entity was hit by a bullet
+struct Contact {
+	Entity* entity;
+	Entity* other;
+	Vector2f point;
+	Vector2f normal;
+	ContactKind kind;
+};
+
+using ContactHandler = void(*)(span<const Contact> contacts);
+
+// An entity on the first layers that touches one on the second raises the contact kind, NONE only filters the pair
+struct CollisionRule {
+	uint16_t first;
+	uint16_t second;
+	ContactKind kind;
+};
+
+class CollisionMatrix {
+public:
+	static const uint16_t getMask(const uint16_t& layer);
+
+	// Detection only reports, side effects wait for dispatch at the end of the update
+	static void report(Entity* entity, Entity* other, vector<Contact>& contacts);
+	static void submit(const vector<Contact>& contacts);
+	static void dispatch();
+private:
+	static void build();
+	static const pair<const Entity*, const Entity*> getKey(const Contact& contact);
+
+	static const vector<CollisionRule> rules;
+	static const array<ContactHandler, static_cast<size_t>(ContactKind::COUNT)> handlers;
+
+	static array<uint16_t, LAYER_COUNT> masks;
+	static array<array<ContactKind, LAYER_COUNT>, LAYER_COUNT> kinds;
+	static bool built;
+
+	static vector<Contact> queue;
+	static mutex queueMutex;
+};
+
+#endif
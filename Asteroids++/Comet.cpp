@@ -1,15 +1,20 @@
 #include "Comet.h"
 #include "WindowBox.h"
 #include "Pickup.h"
+#include "QualityGovernor.h"
 
 Comet::Comet() : Enemy(Player::playerStats.bulletDamage * 15, physics::getRandomFloatValue(FileMenager::enemiesData.asteroid_speed) + 100.0f, getSprite(Sprites::COMET))
 {
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 
 	drawHitboxes();
+
+	body = Kinematics::add(this, EdgeMode::WRAP, FileMenager::enemiesData.asteroid_spin);
+
+	setLayer(LAYER_ENEMY);
 }
 
-void Comet::render(RenderWindow& window)
+void Comet::render(RenderList& window)
 {
     Enemy::render(window);
 }
@@ -18,30 +23,14 @@ void Comet::update(float deltaTime)
 {
     Enemy::update(deltaTime);
 
-    Game::addParticle(new Particle(position, angle, spriteInfo.spriteType, Color(255,255,255,50), 0.5f));
+    // A comet pulled in by a black hole must not jump to the other side of the screen
+    if (spiraling && body != Kinematics::none) Kinematics::setEdgeMode(body, EdgeMode::NONE);
 
-    if (Game::freeze.isEffectActive()) return;
+    if (QualityGovernor::shouldEmitTrail()) Game::addParticle(new Particle(position, angle, spriteInfo.spriteType, Color(255,255,255,50), 0.5f));
 
-    angle += FileMenager::enemiesData.asteroid_spin * deltaTime;
-    position += Vector2f(direction.x * speed * deltaTime, direction.y * speed * deltaTime);
+    if (Game::freeze.isEffectActive()) return;
 
     setSpriteFullCycle(deltaTime);
-
-    if (spiraling) return;
-
-    if (position.x < -radius) {
-        position.x = WindowBox::getVideoMode().width + radius;
-    }
-    else if (position.x > WindowBox::getVideoMode().width + radius) {
-        position.x = -radius;
-    }
-
-    if (position.y < -radius) {
-        position.y = WindowBox::getVideoMode().height + radius;
-    }
-    else if (position.y > WindowBox::getVideoMode().height + radius) {
-        position.y = -radius;
-    }
 }
 
 void Comet::collisionDetection() {}
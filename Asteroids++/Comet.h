@@ -13,7 +13,7 @@ class Comet : public Enemy
 public:
 	Comet();
 	
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void destroy() override;
@@ -0,0 +1,30 @@
+#include "CommandBuffer.h"
+
+thread_local CommandBuffer* CommandBuffer::recording = nullptr;
+
+void CommandBuffer::record(const function<void()>& command)
+{
+	commands.push_back(command);
+}
+
+void CommandBuffer::apply()
+{
+	for (const auto& command : commands) command();
+
+	commands.clear();
+}
+
+CommandBuffer* CommandBuffer::getRecording()
+{
+	return recording;
+}
+
+void CommandBuffer::beginRecording(CommandBuffer* buffer)
+{
+	recording = buffer;
+}
+
+void CommandBuffer::endRecording()
+{
+	recording = nullptr;
+}
@@ -0,0 +1,25 @@
+#pragma once
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+
+#include <vector>
+#include <functional>
+
+using namespace std;
+
+class CommandBuffer {
+public:
+	void record(const function<void()>& command);
+	void apply();
+
+	// While a buffer is recording on this thread, global side effects are queued into it instead
+	static CommandBuffer* getRecording();
+	static void beginRecording(CommandBuffer* buffer);
+	static void endRecording();
+private:
+	vector<function<void()>> commands;
+
+	static thread_local CommandBuffer* recording;
+};
+
+#endif
@@ -0,0 +1,250 @@
+#include "ContactSolver.h"
+#include "Game.h"
+#include "Enemy.h"
+#include "Narrowphase.h"
+#include "Physics.h"
+#include <numeric>
+
+const float restitution = 0.7f;
+const float warmStart = 0.8f;
+const int iterations = 4;
+const float slop = 0.5f;
+const float correction = 0.2f;
+const float sleepSpeed = 20.0f;
+const uint16_t sleepFrames = 60;
+
+unordered_map<ContactKey, CachedContact, ContactKeyHash> ContactSolver::contacts;
+unordered_map<const Enemy*, BodyState> ContactSolver::bodies;
+uint64_t ContactSolver::frame = 0;
+uint32_t ContactSolver::nextIsland = 1;
+
+size_t ContactKeyHash::operator()(const ContactKey& key) const
+{
+	const auto first = hash<const Enemy*>()(key.first);
+	return first ^ (hash<const Enemy*>()(key.second) + 0x9e3779b9 + (first << 6) + (first >> 2));
+}
+
+void ContactSolver::detect()
+{
+	frame++;
+	evict();
+
+	// A blast or a black hole got a sleeper moving again
+	vector<uint32_t> pushed;
+
+	for (const auto& [enemy, body] : bodies)
+		if (body.asleep && enemy->speed > sleepSpeed) pushed.push_back(body.island);
+
+	for (const auto& island : pushed) wake(island);
+
+	const auto& enemies = Game::getEnemyBatch();
+
+	CircleBatch asteroids;
+
+	for (size_t i = 0; i < enemies.size(); i++) {
+		const auto entity = enemies.entities[i];
+		if (entity->layer & LAYER_ASTEROID && !entity->spiraling) asteroids.add(entity);
+	}
+
+	vector<pair<size_t, size_t>> hits;
+	Narrowphase::query(asteroids, asteroids, hits);
+
+	vector<Contact> found;
+
+	for (const auto& [i, j] : hits)
+	{
+		if (i >= j) continue;
+
+		const auto first = static_cast<Enemy*>(asteroids.entities[i]);
+		const auto second = static_cast<Enemy*>(asteroids.entities[j]);
+
+		if (isAsleep(first) && isAsleep(second)) continue;
+
+		CollisionMatrix::report(first, second, found);
+	}
+
+	CollisionMatrix::submit(found);
+}
+
+void ContactSolver::solve(span<const Contact> touching)
+{
+	// Islands are the groups of asteroids linked by a contact this frame
+	unordered_map<Enemy*, size_t> indices;
+	vector<Enemy*> members;
+
+	const auto indexOf = [&](Enemy* enemy) {
+		const auto [found, added] = indices.emplace(enemy, members.size());
+		if (added) members.push_back(enemy);
+		return found->second;
+	};
+
+	vector<CachedContact*> solved;
+
+	for (const auto& contact : touching)
+	{
+		const auto first = static_cast<Enemy*>(contact.entity);
+		const auto second = static_cast<Enemy*>(contact.other);
+
+		auto& cached = contacts[getKey(first, second)];
+
+		cached.first = first;
+		cached.second = second;
+		cached.lastFrame = frame;
+
+		indexOf(first);
+		indexOf(second);
+		solved.push_back(&cached);
+	}
+
+	vector<size_t> parents(members.size());
+	iota(parents.begin(), parents.end(), 0);
+
+	const auto findRoot = [&](size_t member) {
+		while (parents[member] != member) member = parents[member] = parents[parents[member]];
+		return member;
+	};
+
+	for (const auto& contact : solved) parents[findRoot(indices[contact->first])] = findRoot(indices[contact->second]);
+
+	for (const auto& member : members)
+		if (isAsleep(member)) wake(bodies[member].island);
+
+	vector<Vector2f> velocities(members.size());
+
+	for (size_t i = 0; i < members.size(); i++) velocities[i] = members[i]->direction * members[i]->speed;
+
+	// Warm start from what the pair needed last frame, then iterate towards separating velocities
+	for (auto& contact : solved) {
+		const auto a = indices[contact->first];
+		const auto b = indices[contact->second];
+		const auto normal = physics::normalize(contact->first->position - contact->second->position);
+
+		contact->impulse *= warmStart;
+		velocities[a] += normal * (contact->impulse / contact->first->size);
+		velocities[b] -= normal * (contact->impulse / contact->second->size);
+	}
+
+	for (int iteration = 0; iteration < iterations; iteration++) {
+		for (auto& contact : solved) {
+			const auto a = indices[contact->first];
+			const auto b = indices[contact->second];
+			const auto normal = physics::normalize(contact->first->position - contact->second->position);
+
+			const auto approach = physics::dotProduct(velocities[a] - velocities[b], normal);
+			const auto lambda = -(1.0f + restitution) * approach / (1.0f / contact->first->size + 1.0f / contact->second->size);
+
+			const auto previous = contact->impulse;
+			contact->impulse = max(previous + lambda, 0.0f);
+
+			const auto change = contact->impulse - previous;
+			velocities[a] += normal * (change / contact->first->size);
+			velocities[b] -= normal * (change / contact->second->size);
+		}
+	}
+
+	for (auto& contact : solved) {
+		const auto normal = physics::normalize(contact->first->position - contact->second->position);
+		const auto overlap = contact->first->radius + contact->second->radius - physics::distance(contact->first->position, contact->second->position);
+		const auto totalMass = contact->first->size + contact->second->size;
+		const auto push = normal * (max(overlap - slop, 0.0f) * correction);
+
+		contact->first->setPosition(contact->first->position + push * (contact->second->size / totalMass));
+		contact->second->setPosition(contact->second->position - push * (contact->first->size / totalMass));
+	}
+
+	for (size_t i = 0; i < members.size(); i++) members[i]->setVelocity(velocities[i]);
+
+	vector<vector<Enemy*>> islands;
+	unordered_map<size_t, size_t> islandOf;
+
+	for (size_t i = 0; i < members.size(); i++) {
+		const auto [island, added] = islandOf.emplace(findRoot(i), islands.size());
+		if (added) islands.emplace_back();
+
+		islands[island->second].push_back(members[i]);
+	}
+
+	updateSleep(islands);
+}
+
+void ContactSolver::clear()
+{
+	contacts.clear();
+	bodies.clear();
+}
+
+const bool ContactSolver::isAsleep(const Enemy* enemy)
+{
+	const auto body = bodies.find(enemy);
+	return body != bodies.end() && body->second.asleep;
+}
+
+const size_t ContactSolver::getSleepingCount()
+{
+	return ranges::count_if(bodies, [](const auto& body) { return body.second.asleep; });
+}
+
+// Contacts that ended are dropped, but a sleeping pair keeps its impulse for when it wakes up
+void ContactSolver::evict()
+{
+	erase_if(contacts, [](const auto& entry) {
+		const auto& contact = entry.second;
+
+		if (!contact.first->isActive() || !contact.second->isActive()) return true;
+
+		return contact.lastFrame + 1 < frame && !(isAsleep(contact.first) && isAsleep(contact.second));
+	});
+
+	erase_if(bodies, [](const auto& body) { return !body.first->isActive() || (!body.second.asleep && body.second.lastFrame + 1 < frame); });
+}
+
+const ContactKey ContactSolver::getKey(const Enemy* first, const Enemy* second)
+{
+	return first < second ? ContactKey{ first, second } : ContactKey{ second, first };
+}
+
+// An island sleeps once every asteroid in it stayed slow and touching for a while. Only resting contacts are worth
+// putting to sleep, a lone asteroid has no pairs to skip and would just stop drifting, so its count starts over
+void ContactSolver::updateSleep(const vector<vector<Enemy*>>& islands)
+{
+	for (const auto& island : islands) {
+		bool calm = true;
+
+		for (const auto& member : island) {
+			auto& body = bodies[member];
+
+			if (body.lastFrame + 1 != frame) body.calmFrames = 0;
+			body.lastFrame = frame;
+
+			body.calmFrames = physics::length(member->direction * member->speed) < sleepSpeed ? body.calmFrames + 1 : 0;
+			calm = calm && body.calmFrames >= sleepFrames;
+		}
+
+		if (!calm) continue;
+
+		const auto id = nextIsland++;
+
+		for (const auto& member : island) {
+			auto& body = bodies[member];
+
+			body.asleep = true;
+			body.enemy = member;
+			body.velocity = member->direction * member->speed;
+			body.island = id;
+
+			member->setVelocity(Vector2f(0.0f, 0.0f));
+		}
+	}
+}
+
+// The whole island wakes together, anything it picked up while asleep adds to what it had
+void ContactSolver::wake(const uint32_t& island)
+{
+	for (auto& [enemy, body] : bodies) {
+		if (!body.asleep || body.island != island) continue;
+
+		body.asleep = false;
+		body.calmFrames = 0;
+		body.enemy->setVelocity(body.velocity + body.enemy->direction * body.enemy->speed);
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef CONTACTSOLVER_H
+#define CONTACTSOLVER_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <span>
+#include <unordered_map>
+#include <cstdint>
+#include "CollisionMatrix.h"
+
+using namespace sf;
+using namespace std;
+
+class Enemy;
+
+// A touching pair kept across frames, the impulse it needed last time starts the next solve
+struct CachedContact {
+	Enemy* first;
+	Enemy* second;
+	float impulse = 0.0f;
+	uint64_t lastFrame = 0;
+};
+
+// A sleeping body is held still, the velocity it had is given back when its island wakes
+struct BodyState {
+	uint16_t calmFrames = 0;
+	uint64_t lastFrame = 0;
+	bool asleep = false;
+
+	Enemy* enemy = nullptr;
+	Vector2f velocity;
+	uint32_t island = 0;
+};
+
+struct ContactKey {
+	const Enemy* first;
+	const Enemy* second;
+
+	bool operator==(const ContactKey& other) const = default;
+};
+
+struct ContactKeyHash {
+	size_t operator()(const ContactKey& key) const;
+};
+
+// Bounces between asteroids, every touching pair is found and solved once a frame.
+// Groups of touching asteroids that stay slow fall asleep together and are skipped until something awake hits them
+class ContactSolver {
+public:
+	static void detect();
+	static void solve(span<const Contact> contacts);
+	static void clear();
+
+	static const bool isAsleep(const Enemy* enemy);
+	static const size_t getSleepingCount();
+private:
+	static void evict();
+	static const ContactKey getKey(const Enemy* first, const Enemy* second);
+	static void updateSleep(const vector<vector<Enemy*>>& islands);
+	static void wake(const uint32_t& island);
+
+	static unordered_map<ContactKey, CachedContact, ContactKeyHash> contacts;
+	static unordered_map<const Enemy*, BodyState> bodies;
+	static uint64_t frame;
+	static uint32_t nextIsland;
+};
+
+#endif
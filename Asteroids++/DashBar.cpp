@@ -19,7 +19,7 @@ void DashBar::update(double newCurrentValue)
     updateSprite(spriteInfo.sprite, spriteInfo.frames, (int)spriteInfo.spriteState);
 }
 
-void DashBar::draw(RenderWindow& window) const
+void DashBar::draw(RenderList& window) const
 {
 	window.draw(spriteInfo.sprite, Transform().translate(position));
 }
@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "SpriteData.h"
+#include "RenderList.h"
 
 using namespace sf;
 using namespace std;
@@ -17,7 +18,7 @@ public:
     DashBar();
 
     void update(double deltaTime);
-    void draw(RenderWindow& window) const;
+    void draw(RenderList& window) const;
 };
 
 #endif
\ No newline at end of file
@@ -58,7 +58,7 @@ void DeathScreen::resetPosition() {
 	}
 }
 
-void DeathScreen::init(const float& deltaTime, RenderWindow& window) {
+void DeathScreen::init(const float& deltaTime, RenderList& window) {
 	if (!death.isEffectActive() && Game::getGameState() == DEATH) {
 		Game::setGameState(PLAYING);
 		return;
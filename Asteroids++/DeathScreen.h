@@ -13,7 +13,7 @@ public:
 
 	void update(float deltaTime) override;
 	const EntityType getEntityType() override;
-	void init(const float& deltaTime, RenderWindow& window) override;
+	void init(const float& deltaTime, RenderList& window) override;
 	void initParticles() override;
 
 	static void activateDeathScreen(const float& duration);
@@ -1,15 +1,55 @@
 #include "Effect.h"
 #include "Entity.h"
 
-Effect::Effect(float duration, bool active, Bar* bar) : duration(duration), active(active), bar(bar) {}
+Effect::Effect(float duration, bool active, Bar* bar) : duration(duration), active(active), bar(bar), deadline(0.0), self(make_shared<Effect*>(this)), timer(0) {}
 
-Effect::Effect(float duration, bool active) : duration(duration), active(active), bar(new Bar()) {}
+Effect::Effect(float duration, bool active, Bar* bar, const GameClock& clock) : duration(duration), active(active), bar(bar), clock(clock), deadline(Timers::now(clock) + duration), self(make_shared<Effect*>(this)), timer(0)
+{
+	arm();
+}
+
+Effect::Effect(float duration, bool active, const GameClock& clock) : Effect(duration, active, nullptr, clock) {}
+
+Effect::Effect(float duration, bool active) : Effect(duration, active, nullptr) {}
+
+Effect::Effect() : Effect(15.0f, false, nullptr) {}
+
+Effect::Effect(const Effect& other) : duration(other.duration), active(other.active), bar(other.bar), clock(other.clock), deadline(other.deadline), self(make_shared<Effect*>(this)), timer(0)
+{
+	arm();
+}
+
+Effect& Effect::operator=(const Effect& other)
+{
+	duration = other.duration;
+	active = other.active;
+	bar = other.bar;
+	clock = other.clock;
+	deadline = other.deadline;
+
+	arm();
 
-Effect::Effect() : active(false), duration(15.0f), bar(new Bar()) {}
+	return *this;
+}
+
+// Replaces whatever expiry was scheduled, an inactive or hand counted effect has none
+void Effect::arm()
+{
+	if (timer) Timers::cancel(timer);
+	timer = 0;
+
+	if (!clock || !active) return;
+
+	timer = Timers::after(max(getEffectDuration(), 0.0f), [effect = weak_ptr<Effect*>(self)]() {
+		if (const auto owner = effect.lock()) (*owner)->active = false;
+	}, *clock);
+}
 
 void Effect::setEffectActive(const bool& newEffectState)
 {
 	active = newEffectState;
+
+	arm();
 }
 
 bool Effect::isEffectActive() const
@@ -20,10 +60,18 @@ bool Effect::isEffectActive() const
 void Effect::setEffectDuration(const float& newDuration)
 {
 	duration = newDuration;
+
+	if (!clock) return;
+
+	deadline = Timers::now(*clock) + newDuration;
+	arm();
 }
 
+// Clocked effects are run down by their timer
 void Effect::updateEffectDuration(const float& deltaDuration)
 {
+	if (clock) return;
+
 	duration -= deltaDuration;
 
 	if (duration < 0) active = false;
@@ -31,18 +79,20 @@ void Effect::updateEffectDuration(const float& deltaDuration)
 
 float Effect::getEffectDuration() const
 {
+	if (clock) return float(deadline - Timers::now(*clock));
+
 	return duration;
 }
 
 void Effect::startEffect(const float& newDuration){
-	duration = newDuration;
 	active = true;
+	setEffectDuration(newDuration);
 }
 
 Bar* Effect::getBar(){
-	return bar;
+	return bar.get();
 }
 
 void Effect::setBar(Bar* bar){
-	this->bar = bar;
+	this->bar.reset(bar);
 }
\ No newline at end of file
@@ -3,8 +3,11 @@
 #define EFFECT_H
 
 #include <unordered_map>
+#include <memory>
+#include <optional>
 #include "Entity.h"
 #include "Bar.h"
+#include "Timers.h"
 #include <vector>
 
 using namespace std;
@@ -14,16 +17,31 @@ enum Groups
 	FREEZE_GROUP
 };
 
+// Counts down by hand through updateEffectDuration, or expires through a timer on the given clock
 class Effect{
 	float duration;
 	bool active;
-	Bar* bar;
+	shared_ptr<Bar> bar;
+
+	optional<GameClock> clock;
+	double deadline;
+
+	// The expiry timer only holds a weak reference, so a destroyed or reassigned effect is never touched
+	shared_ptr<Effect*> self;
+	uint32_t timer;
+
+	void arm();
 
 public:
 	Effect(float duration, bool active, Bar* bar);
+	Effect(float duration, bool active, Bar* bar, const GameClock& clock);
+	Effect(float duration, bool active, const GameClock& clock);
 	Effect(float duration, bool active);
 	Effect();
 
+	Effect(const Effect& other);
+	Effect& operator=(const Effect& other);
+
 	void setEffectActive(const bool& newEffectState);
 	bool isEffectActive() const;
 	void setEffectDuration(const float& newduration);
@@ -2,10 +2,8 @@
 #include "Score.h"
 #include "WindowBox.h"
 #include "BlackHole.h"
+#include "QualityGovernor.h"
 
-const vector<Sprites> Enemy::avoidCollisionGroup{ Sprites::COMET, Sprites::TOWER, Sprites::STRAUNER, Sprites::BLACKHOLE };
-const vector<Sprites> Enemy::blackHoleGroup{ Sprites::STRAUNER, Sprites::BLACKHOLE };
-const vector<EntityType> Enemy::enemies{ EntityType::TYPE_ENEMY, EntityType::TYPE_ENEMY_BULLET };
 
 Enemy::Enemy(float health, float speed, SpriteInfo spriteInfo) :
 	Entity(getRandomPosition(), physics::getRandomAngle(), physics::getRandomFloatValue(FileMenager::enemiesData.asteroid_size), Color::Red, spriteInfo),
@@ -13,21 +11,33 @@ Enemy::Enemy(float health, float speed, SpriteInfo spriteInfo) :
 	healthBar(size, 3.0f, Color::Red, Color::Black, health + Player::playerStats.bulletDamage / 2, { -100.0f, -100.0f }),
 	direction(physics::getRandomDirection()),
 	speed(speed),
+	poisoned(false),
 	crit("CRIT", 0),
-	critTimer(2.0f, false)
+	showCrit(false),
+	body(Kinematics::none)
 {
 	maxHealth = health;
 	crit.setColorText(Color::Red);
 	crit.setTextPosition(position);
 	crit.setSize(32);
+
+	setLayer(LAYER_ASTEROID);
+}
+
+Enemy::~Enemy()
+{
+	Kinematics::remove(body);
 }
 
-void Enemy::render(RenderWindow& window)
+void Enemy::render(RenderList& window)
 {
 	Transform transform;
 	window.draw(spriteInfo.sprite, transform.translate(position).rotate(angle));
 	if (Game::hitboxesVisibility) window.draw(shape, transform);
-	if (critTimer.isEffectActive()) window.draw(crit.getText());
+
+	if (!QualityGovernor::isDetailVisible(position)) return;
+
+	if (showCrit) window.draw(crit.getText());
 	getHealthBar().draw(window);
 }
 
@@ -37,54 +47,17 @@ void Enemy::update(float deltaTime)
 
 	Entity::update(deltaTime);
 
-	updateCritDamage(deltaTime);
+	if (spiraling && body != Kinematics::none) Kinematics::setPosition(body, position);
 
 	if (getHealth() <= 0) destroy();
 }
 
 
-void Enemy::updateCritDamage(float deltaTime) {
-	crit.setTextPosition(Vector2f(position.x - crit.getText().getLocalBounds().width / 2, position.y - crit.getText().getLocalBounds().height));
-
-	if (critTimer.isEffectActive()) {
-		critTimer.updateEffectDuration(deltaTime);
-
-		float opacity = 255.0f * (critTimer.getEffectDuration() / 0.4f);
-
-		Color color = crit.getText().getFillColor();
-		color.a = static_cast<Uint8>(opacity);
-
-		crit.setColorText(color);
-	}
-}
-
 const EntityType Enemy::getEntityType()
 {
 	return EntityType::TYPE_ENEMY;
 }
 
-void Enemy::bounceCollisionDetection()
-{
-	Game::foreachEntity([&](Entity* entity) {
-		if ((entity->getEntityType() == EntityType::TYPE_ENEMY && !Game::isEntityInsideGruop(entity, avoidCollisionGroup) && !entity->spiraling)
-			&& entity != this) {
-			Enemy* otherEnemy = dynamic_cast<Enemy*>(entity);
-
-			if (!otherEnemy) return;
-
-			if (physics::intersects(this->position, radius, otherEnemy->position, otherEnemy->radius)) {
-				const auto bounceDirection = physics::bounceDirection(this, otherEnemy, 0.05f);
-
-				this->position += bounceDirection.second;
-				otherEnemy->position -= bounceDirection.second;
-
-				this->direction -= bounceDirection.first;
-				otherEnemy->direction += bounceDirection.first;
-			}
-		}
-	});
-}
-
 const Vector2f Enemy::getRandomPosition() const
 {
 	auto player = Game::doesEntityExist(EntityType::TYPE_PLAYER);
@@ -130,4 +103,26 @@ void Enemy::increaseHealth(const float& newValue){
 	health += newValue;
 
 	healthBar.updateMaxValue(newValue);
+}
+
+void Enemy::setPosition(const Vector2f& newPosition)
+{
+	position = newPosition;
+
+	if (body != Kinematics::none) Kinematics::setPosition(body, position);
+}
+
+void Enemy::setDirection(const Vector2f& newDirection)
+{
+	direction = newDirection;
+
+	if (body != Kinematics::none) Kinematics::setDirection(body, direction);
+}
+
+void Enemy::setVelocity(const Vector2f& velocity)
+{
+	speed = physics::length(velocity);
+	if (speed > 0.0f) direction = velocity / speed;
+
+	if (body != Kinematics::none) Kinematics::setVelocity(body, velocity);
 }
\ No newline at end of file
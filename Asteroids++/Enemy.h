@@ -7,27 +7,28 @@
 #include "Game.h"
 #include "FileMenager.h"
 #include "Bar.h"
-#include "Bullet.h"
+#include "Explosion.h"
 #include <iostream>
 #include <random>
 #include <ranges>
 #include "Physics.h"
 #include "TextField.h"
 #include "Effect.h"
+#include "Kinematics.h"
 
 class BlackHole;
 
 class Enemy : public Entity {
 public:
 	Enemy(float health, float speed, SpriteInfo spriteInfo);
+	~Enemy();
 
-	virtual void render(RenderWindow& window) override;
+	virtual void render(RenderList& window) override;
 	virtual void update(float deltaTime) override;
 	virtual const EntityType getEntityType() override;
 	virtual void collisionDetection() override = 0;
 	virtual void destroy() = 0;
 
-	void bounceCollisionDetection();
 	const Vector2f getRandomPosition() const;
 
 	const Bar& getHealthBar() const;
@@ -39,18 +40,18 @@ public:
 
 	void increaseHealth(const float& newValue);
 
+	void setPosition(const Vector2f& newPosition);
+	void setDirection(const Vector2f& newDirection);
+	void setVelocity(const Vector2f& velocity);
+
 	float speed;
 	bool poisoned;
 	Vector2f direction;
 	TextField crit;
-	Effect critTimer;
+	bool showCrit;
+	size_t body;
 
-	static const vector<EntityType> enemies;
-	static const vector<Sprites> avoidCollisionGroup;
-	static const vector<Sprites> blackHoleGroup;
 private:
-	void updateCritDamage(float deltaTime);
-
 	Bar healthBar;
 	float health;
 	float maxHealth;
@@ -9,8 +9,13 @@ const float spiralingSpeed = 15.0f;
 Entity::Entity(Vector2f position, float angle, float size, Color hitboxColor, SpriteInfo spriteInfo)
 	: position(position), angle(angle), size(size), hitboxColor(hitboxColor), radius(float(static_cast<int>(size) >> 1)), spriteInfo(spriteInfo) , spiraling(false), spiralingTarget(nullptr)
 {
+	setLayer(LAYER_EFFECT);
 }
 
+void Entity::think() {}
+
+void Entity::integrate(float) {}
+
 void Entity::update(float deltaTime)
 {
 	if (spiraling) {
@@ -97,4 +102,15 @@ void Entity::setSpriteFullCycle(SpriteInfo& spriteInfo) {
 void Entity::startSpiraling(BlackHole* blackHole) {
 	spiraling = true;
 	spiralingTarget = blackHole;
+}
+
+void Entity::setLayer(const uint16_t& layer)
+{
+	this->layer = layer;
+	mask = CollisionMatrix::getMask(layer);
+}
+
+const bool Entity::collidesWith(const Entity* other) const
+{
+	return (mask & other->layer) != 0;
 }
\ No newline at end of file
@@ -5,12 +5,12 @@
 #include <SFML/Graphics.hpp>
 #include "SoundData.h"
 #include "SpriteData.h"
+#include "RenderList.h"
+#include "CollisionMatrix.h"
 
 enum EntityType {
     TYPE_ENEMY,
     TYPE_PLAYER,
-    TYPE_BULLET_SINGLE,
-    TYPE_ENEMY_BULLET,
     TYPE_EXPLOSION,
     TYPE_PICKUP,
     TYPE_PARTICLE,
@@ -26,9 +26,13 @@ class Entity : public SpriteData {
 public:
     
     Entity(Vector2f position, float angle, float size, Color hitboxColor, SpriteInfo spriteInfo);
+    virtual ~Entity() = default;
 
+    // think and integrate run on worker threads: read the world, write only this entity
+    virtual void think();
+    virtual void integrate(float deltaTime);
     virtual void update(float deltaTime);
-    virtual void render(RenderWindow& window) = 0;
+    virtual void render(RenderList& window) = 0;
     virtual const EntityType getEntityType() = 0;
     virtual void collisionDetection() = 0;
 
@@ -45,6 +49,9 @@ public:
 
     void startSpiraling(BlackHole* blackHole);
 
+    void setLayer(const uint16_t& layer);
+    const bool collidesWith(const Entity* other) const;
+
     Color hitboxColor;
     Vector2f position;
     CircleShape shape;
@@ -53,6 +60,9 @@ public:
     float size;
     float radius;
     SpriteInfo spriteInfo;
+
+    uint16_t layer;
+    uint16_t mask;
 };
 
 #endif
\ No newline at end of file
@@ -4,7 +4,7 @@ EventHandler::EventHandler(VertexArray particles) : particles(particles)
 {
 }
 
-void EventHandler::render(RenderWindow& window) const
+void EventHandler::render(RenderList& window) const
 {
 	window.draw(particles);
 }
\ No newline at end of file
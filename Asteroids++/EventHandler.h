@@ -5,6 +5,7 @@
 #include "SFML/Graphics.hpp"
 #include "Entity.h"
 #include "Effect.h"
+#include "RenderList.h"
 
 using namespace sf;
 
@@ -15,10 +16,10 @@ public:
 
 	virtual void update(float deltaTime) = 0;
 	virtual const EntityType getEntityType() = 0;
-	virtual void init(const float& deltaTime, RenderWindow& window) = 0;
+	virtual void init(const float& deltaTime, RenderList& window) = 0;
 	virtual void initParticles() = 0;
 
-	void render(RenderWindow& window) const;
+	void render(RenderList& window) const;
 
 	VertexArray particles;
 private:
@@ -24,7 +24,7 @@ void Explosion::update(float deltaTime)
     setSpriteFullCycle(deltaTime);
 }
 
-void Explosion::render(sf::RenderWindow& window)
+void Explosion::render(RenderList& window)
 {
     window.draw(spriteInfo.sprite, Transform().translate(position));
 }
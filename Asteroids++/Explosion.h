@@ -14,7 +14,7 @@ public:
 	Explosion(Vector2f position, float size, SpriteInfo spriteInfo);
 
 	void update(float deltaTime) override;
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	const EntityType getEntityType() override;
 	void collisionDetection() override;
 
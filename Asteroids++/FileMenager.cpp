@@ -9,6 +9,7 @@ DrawsData FileMenager::drawsData;
 TimingsData FileMenager::timingsData;
 GameData FileMenager::gameData;
 vector<pair<string, float>> FileMenager::highScore;
+map<string, float> FileMenager::keyBindings;
 
 FileMenager::FileMenager(){
 	fileName = nullptr;
@@ -115,6 +116,14 @@ void FileMenager::setDataFromFile() const {
 	screenData.fps_pos_x = dataMap["fps_pos_x"];
 	screenData.fps_pos_y = dataMap["fps_pos_y"];
 	screenData.game_next_level_spike = dataMap["game_next_level_spike"];
+	screenData.texture_cache_budget = static_cast<int>(dataMap["texture_cache_budget"]);
+	screenData.input_late_sampling = static_cast<int>(dataMap["input_late_sampling"]);
+	screenData.frame_pacing_mode = static_cast<int>(dataMap["frame_pacing_mode"]);
+	screenData.quality_governor = static_cast<int>(dataMap["quality_governor"]);
+	screenData.frame_budget_high = dataMap["frame_budget_high"];
+	screenData.frame_budget_low = dataMap["frame_budget_low"];
+	screenData.worker_threads = static_cast<int>(dataMap["worker_threads"]);
+	screenData.render_thread = static_cast<int>(dataMap["render_thread"]);
 
 	// Player data
 	playerData.size = dataMap["player_size"];
@@ -150,6 +159,9 @@ void FileMenager::setDataFromFile() const {
 	enemiesData.enemy_multiasteroid_spawn_chance = dataMap["enemy_multiasteroid_spawn_chance"];
 	enemiesData.enemy_singleasteroid_spawn_chance = dataMap["enemy_singleasteroid_spawn_chance"];
 	enemiesData.enemy_blackhole_increse_size = dataMap["enemy_blackhole_increse_size"];
+	enemiesData.enemy_blackhole_gravity = dataMap["enemy_blackhole_gravity"];
+	enemiesData.enemy_blackhole_max_size = dataMap["enemy_blackhole_max_size"];
+	enemiesData.ai_think_rate = dataMap["enemy_ai_think_rate"];
 
 	// Draws data
 	drawsData.outline_fill_background_opacity = static_cast<int>(dataMap["outline_fill_background_opacity"]);
@@ -176,5 +188,10 @@ void FileMenager::setDataFromFile() const {
 	gameData.debug_mode = static_cast<int>(dataMap["debug_mode"]);
 	gameData.wind_chance = dataMap["wind_chance"];
 
+	// Key bindings
+	for (const auto& [key, value] : dataMap) {
+		if (key.starts_with("bind_")) keyBindings[key.substr(5)] = value;
+	}
+
 	return;
 }
\ No newline at end of file
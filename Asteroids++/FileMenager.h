@@ -21,6 +21,14 @@ struct ScreenData {
     float fps_pos_x;
     float fps_pos_y;
     float game_next_level_spike;
+    int texture_cache_budget;
+    int input_late_sampling;
+    int frame_pacing_mode;
+    int quality_governor;
+    float frame_budget_high;
+    float frame_budget_low;
+    int worker_threads;
+    int render_thread;
 };
 
 struct PlayerData {
@@ -53,6 +61,9 @@ struct EnemiesData {
     float asteroid_size;
 
     float enemy_blackhole_increse_size;
+    float enemy_blackhole_gravity;
+    float enemy_blackhole_max_size;
+    float ai_think_rate;
 
     float enemy_tower_spawn_chance;
     float enemy_strauner_spawn_chance;
@@ -104,6 +115,7 @@ public:
 	static TimingsData timingsData;
     static GameData gameData;
     static vector<pair<string, float>> highScore;
+    static map<string, float> keyBindings;
     FileMenager();
     ~FileMenager();
 
@@ -0,0 +1,115 @@
+#include "Flocking.h"
+#include "Invader.h"
+#include "Game.h"
+#include "JobSystem.h"
+#include <cmath>
+
+const float neighbourRadius = 96.0f;
+const float separationRadius = 40.0f;
+const size_t maxNeighbours = 12;
+
+const float separationWeight = 1.5f;
+const float alignmentWeight = 0.6f;
+const float cohesionWeight = 0.4f;
+
+vector<float> Flocking::x;
+vector<float> Flocking::y;
+vector<float> Flocking::headingX;
+vector<float> Flocking::headingY;
+vector<float> Flocking::steeringX;
+vector<float> Flocking::steeringY;
+vector<Invader*> Flocking::members;
+
+SpatialGrid Flocking::grid;
+
+void Flocking::update()
+{
+	gather();
+
+	if (members.size() < 2) {
+		for (auto& member : members) member->flock(Vector2f());
+		return;
+	}
+
+	grid.build(x, y, neighbourRadius);
+
+	vector<vector<size_t>> neighbours(JobSystem::getChunkCount());
+
+	JobSystem::parallelFor(members.size(), [&](const size_t& begin, const size_t& end, const size_t& chunk) {
+		steer(begin, end, neighbours[chunk]);
+	});
+
+	for (size_t i = 0; i < members.size(); i++) members[i]->flock(Vector2f(steeringX[i], steeringY[i]));
+}
+
+void Flocking::gather()
+{
+	x.clear();
+	y.clear();
+	headingX.clear();
+	headingY.clear();
+	members.clear();
+
+	const auto& enemies = Game::getEnemyBatch();
+	for (size_t i = 0; i < enemies.size(); i++) {
+		if (enemies.entities[i]->getSpriteType() != Sprites::INVADER) continue;
+
+		const auto invader = static_cast<Invader*>(enemies.entities[i]);
+		const auto& heading = invader->getHeading();
+
+		x.push_back(enemies.x[i]);
+		y.push_back(enemies.y[i]);
+		headingX.push_back(heading.x);
+		headingY.push_back(heading.y);
+		members.push_back(invader);
+	}
+
+	steeringX.assign(members.size(), 0.0f);
+	steeringY.assign(members.size(), 0.0f);
+}
+
+void Flocking::steer(const size_t& begin, const size_t& end, vector<size_t>& neighbours)
+{
+	for (auto i = begin; i < end; i++) {
+		neighbours.clear();
+		grid.queryRadius(Vector2f(x[i], y[i]), neighbourRadius, neighbours, maxNeighbours + 1);
+
+		float separationX = 0.0f, separationY = 0.0f;
+		float alignmentX = 0.0f, alignmentY = 0.0f;
+		float centerX = 0.0f, centerY = 0.0f;
+		size_t count = 0;
+
+		for (const auto j : neighbours) {
+			if (j == i) continue;
+
+			const auto dx = x[j] - x[i];
+			const auto dy = y[j] - y[i];
+			const auto distanceSquared = dx * dx + dy * dy;
+
+			if (distanceSquared < separationRadius * separationRadius && distanceSquared > 0.0f) {
+				separationX -= dx / distanceSquared * separationRadius;
+				separationY -= dy / distanceSquared * separationRadius;
+			}
+
+			alignmentX += headingX[j];
+			alignmentY += headingY[j];
+			centerX += x[j];
+			centerY += y[j];
+			count++;
+		}
+
+		if (count == 0) continue;
+
+		auto cohesionX = centerX / count - x[i];
+		auto cohesionY = centerY / count - y[i];
+		const auto cohesionLength = sqrt(cohesionX * cohesionX + cohesionY * cohesionY);
+
+		if (cohesionLength > 0.0f) {
+			cohesionX /= cohesionLength;
+			cohesionY /= cohesionLength;
+		}
+
+		steeringX[i] = separationX * separationWeight + alignmentX / count * alignmentWeight + cohesionX * cohesionWeight;
+		steeringY[i] = separationY * separationWeight + alignmentY / count * alignmentWeight + cohesionY * cohesionWeight;
+	}
+}
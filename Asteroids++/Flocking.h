@@ -0,0 +1,33 @@
+#pragma once
+#ifndef FLOCKING_H
+#define FLOCKING_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "SpatialGrid.h"
+
+using namespace sf;
+using namespace std;
+
+class Invader;
+
+// Separation, alignment and cohesion for every invader, neighbours come from a grid and are capped per boid
+class Flocking {
+public:
+	static void update();
+private:
+	static void gather();
+	static void steer(const size_t& begin, const size_t& end, vector<size_t>& neighbours);
+
+	static vector<float> x;
+	static vector<float> y;
+	static vector<float> headingX;
+	static vector<float> headingY;
+	static vector<float> steeringX;
+	static vector<float> steeringY;
+	static vector<Invader*> members;
+
+	static SpatialGrid grid;
+};
+
+#endif
@@ -0,0 +1,187 @@
+#include "FlowField.h"
+#include "Game.h"
+#include "AIScheduler.h"
+#include "CollisionMatrix.h"
+#include "WindowBox.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+const float cellSize = 48.0f;
+const float passInterval = 0.25f;
+const size_t cellsPerFrame = 384;
+
+const float blackHoleZone = 3.0f;
+const float blackHoleCost = 40.0f;
+const float crowdCost = 4.0f;
+
+const float unreached = numeric_limits<float>::max();
+
+int FlowField::columns = 0;
+int FlowField::rows = 0;
+float FlowField::sinceLastPass = passInterval;
+bool FlowField::passRunning = false;
+
+vector<Vector2f> FlowField::directions;
+vector<Vector2f> FlowField::pendingDirections;
+vector<float> FlowField::costs;
+vector<float> FlowField::distances;
+priority_queue<FlowField::OpenCell, vector<FlowField::OpenCell>, greater<FlowField::OpenCell>> FlowField::open;
+
+void FlowField::update(const float& deltaTime)
+{
+	if (Game::freeze.isEffectActive()) return;
+
+	sinceLastPass += deltaTime;
+
+	if (!passRunning) {
+		if (sinceLastPass < passInterval || !AIScheduler::getBlackboard().hasPlayer) return;
+		beginPass();
+	}
+
+	// Dijkstra is spread over a few frames, chasers keep reading the previous field until this one is done
+	expand(cellsPerFrame);
+
+	if (open.empty()) finishPass();
+}
+
+void FlowField::clear()
+{
+	directions.assign(directions.size(), Vector2f());
+	open = {};
+	passRunning = false;
+	sinceLastPass = passInterval;
+}
+
+const Vector2f FlowField::sample(const Vector2f& position)
+{
+	if (directions.empty()) return Vector2f();
+
+	return directions[size_t(getRow(position.y)) * columns + getColumn(position.x)];
+}
+
+void FlowField::beginPass()
+{
+	const auto mode = WindowBox::getVideoMode();
+	const auto newColumns = int(ceil(mode.width / cellSize));
+	const auto newRows = int(ceil(mode.height / cellSize));
+
+	if (newColumns != columns || newRows != rows) {
+		columns = newColumns;
+		rows = newRows;
+		directions.assign(size_t(columns) * rows, Vector2f());
+	}
+
+	const auto cells = size_t(columns) * rows;
+	costs.assign(cells, 1.0f);
+	distances.assign(cells, unreached);
+	pendingDirections.assign(cells, Vector2f());
+
+	// Costs are taken once per pass, the world moving during the pass is picked up by the next one
+	const auto& enemies = Game::getEnemyBatch();
+	for (size_t i = 0; i < enemies.size(); i++) {
+		const Vector2f position(enemies.x[i], enemies.y[i]);
+
+		if (enemies.entities[i]->layer == LAYER_BLACKHOLE) addCost(position, enemies.radius[i] * blackHoleZone, blackHoleCost, true);
+		else addCost(position, enemies.radius[i], crowdCost, false);
+	}
+
+	const auto& player = AIScheduler::getBlackboard().playerPosition;
+	const auto target = size_t(getRow(player.y)) * columns + getColumn(player.x);
+
+	open = {};
+	distances[target] = 0.0f;
+	open.push({ 0.0f, target });
+
+	sinceLastPass = 0.0f;
+	passRunning = true;
+}
+
+void FlowField::expand(size_t budget)
+{
+	const float diagonal = sqrt(2.0f);
+
+	while (!open.empty() && budget-- > 0) {
+		const auto [distance, cell] = open.top();
+		open.pop();
+
+		if (distance > distances[cell]) continue;
+
+		const int column = int(cell % columns);
+		const int row = int(cell / columns);
+
+		for (int y = -1; y <= 1; y++) {
+			for (int x = -1; x <= 1; x++) {
+				if ((x == 0 && y == 0) || column + x < 0 || column + x >= columns || row + y < 0 || row + y >= rows) continue;
+
+				const auto neighbour = size_t(row + y) * columns + (column + x);
+				const auto step = (x != 0 && y != 0 ? diagonal : 1.0f) * (costs[cell] + costs[neighbour]) / 2;
+
+				if (distance + step < distances[neighbour]) {
+					distances[neighbour] = distance + step;
+					open.push({ distances[neighbour], neighbour });
+				}
+			}
+		}
+	}
+}
+
+void FlowField::finishPass()
+{
+	for (int row = 0; row < rows; row++) {
+		for (int column = 0; column < columns; column++) {
+			const auto cell = size_t(row) * columns + column;
+			auto best = distances[cell];
+			Vector2f direction;
+
+			for (int y = -1; y <= 1; y++) {
+				for (int x = -1; x <= 1; x++) {
+					if (column + x < 0 || column + x >= columns || row + y < 0 || row + y >= rows) continue;
+
+					const auto neighbour = size_t(row + y) * columns + (column + x);
+
+					if (distances[neighbour] < best) {
+						best = distances[neighbour];
+						direction = Vector2f(float(x), float(y));
+					}
+				}
+			}
+
+			// The player's own cell and anything cut off point nowhere, chasers go straight at the player there
+			pendingDirections[cell] = direction == Vector2f() ? direction : direction / sqrt(direction.x * direction.x + direction.y * direction.y);
+		}
+	}
+
+	directions.swap(pendingDirections);
+	passRunning = false;
+}
+
+void FlowField::addCost(const Vector2f& position, const float& radius, const float& cost, const bool& fade)
+{
+	const auto firstColumn = getColumn(position.x - radius);
+	const auto lastColumn = getColumn(position.x + radius);
+	const auto firstRow = getRow(position.y - radius);
+	const auto lastRow = getRow(position.y + radius);
+
+	for (int row = firstRow; row <= lastRow; row++) {
+		for (int column = firstColumn; column <= lastColumn; column++) {
+			const auto dx = (column + 0.5f) * cellSize - position.x;
+			const auto dy = (row + 0.5f) * cellSize - position.y;
+			const auto distance = sqrt(dx * dx + dy * dy);
+
+			if (distance > radius + cellSize / 2) continue;
+
+			costs[size_t(row) * columns + column] += fade ? cost * max(1.0f - distance / radius, 0.1f) : cost;
+		}
+	}
+}
+
+const int FlowField::getColumn(const float& x)
+{
+	return clamp(int(x / cellSize), 0, columns - 1);
+}
+
+const int FlowField::getRow(const float& y)
+{
+	return clamp(int(y / cellSize), 0, rows - 1);
+}
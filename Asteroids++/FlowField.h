@@ -0,0 +1,44 @@
+#pragma once
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <queue>
+#include <functional>
+
+using namespace sf;
+using namespace std;
+
+// Cheapest way to the player for every cell of the screen, chasers steer by reading the cell they're in
+class FlowField {
+public:
+	static void update(const float& deltaTime);
+	static void clear();
+
+	static const Vector2f sample(const Vector2f& position);
+private:
+	static void beginPass();
+	static void expand(size_t budget);
+	static void finishPass();
+
+	static void addCost(const Vector2f& position, const float& radius, const float& cost, const bool& fade);
+
+	static const int getColumn(const float& x);
+	static const int getRow(const float& y);
+
+	static int columns;
+	static int rows;
+	static float sinceLastPass;
+	static bool passRunning;
+
+	static vector<Vector2f> directions;
+	static vector<Vector2f> pendingDirections;
+	static vector<float> costs;
+	static vector<float> distances;
+
+	using OpenCell = pair<float, size_t>;
+	static priority_queue<OpenCell, vector<OpenCell>, greater<OpenCell>> open;
+};
+
+#endif
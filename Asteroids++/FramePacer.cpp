@@ -0,0 +1,137 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+
+const size_t frameHistory = 240;
+const Int64 minSleepMargin = 200;
+const Int64 maxSleepMargin = 4000;
+
+PacingMode FramePacer::mode{ PacingMode::HYBRID };
+Int64 FramePacer::framePeriod{ 0 };
+Int64 FramePacer::nextDeadline{ 0 };
+Int64 FramePacer::lastFrameEnd{ 0 };
+Int64 FramePacer::sleepMargin{ 1000 };
+vector<Int64> FramePacer::frameTimes(frameHistory);
+size_t FramePacer::frameIndex{ 0 };
+size_t FramePacer::frameCount{ 0 };
+Clock FramePacer::clock;
+
+void FramePacer::init(RenderWindow& window, const PacingMode& newMode, const int& framerate)
+{
+	mode = newMode;
+	framePeriod = mode == PacingMode::UNLIMITED || mode == PacingMode::VSYNC ? 0 : 1000000 / max(framerate, 1);
+
+	window.setFramerateLimit(0);
+	window.setVerticalSyncEnabled(mode == PacingMode::VSYNC);
+
+	lastFrameEnd = now();
+	nextDeadline = lastFrameEnd + framePeriod;
+}
+
+void FramePacer::waitUntil(const Int64& target)
+{
+	if (mode == PacingMode::UNLIMITED || mode == PacingMode::VSYNC) return;
+
+	const auto sleepTime = target - now() - sleepMargin;
+
+	if (sleepTime > 0) {
+		const auto sleepStart = now();
+		sleep(microseconds(sleepTime));
+
+		adaptSleepMargin(now() - sleepStart - sleepTime);
+	}
+
+	if (mode != PacingMode::HYBRID) return;
+
+	while (now() < target) {}
+}
+
+void FramePacer::endFrame()
+{
+	waitUntil(nextDeadline);
+
+	const auto frameEnd = now();
+
+	frameTimes[frameIndex] = frameEnd - lastFrameEnd;
+	frameIndex = (frameIndex + 1) % frameHistory;
+	frameCount = min(frameCount + 1, frameHistory);
+
+	lastFrameEnd = frameEnd;
+
+	// Keep the deadlines on a fixed grid, but don't try to catch up after a long stall
+	nextDeadline += framePeriod;
+	if (nextDeadline < frameEnd) nextDeadline = frameEnd + framePeriod;
+}
+
+const Int64 FramePacer::now()
+{
+	return clock.getElapsedTime().asMicroseconds();
+}
+
+const Int64 FramePacer::getNextDeadline()
+{
+	return nextDeadline;
+}
+
+const Int64 FramePacer::getSleepMargin()
+{
+	return sleepMargin;
+}
+
+const float FramePacer::getMean()
+{
+	if (frameCount == 0) return 0.0f;
+
+	Int64 sum = 0;
+	for (size_t i = 0; i < frameCount; i++) sum += frameTimes[i];
+
+	return static_cast<float>(sum) / frameCount;
+}
+
+const float FramePacer::getStandardDeviation()
+{
+	if (frameCount == 0) return 0.0f;
+
+	const auto mean = getMean();
+	float variance = 0.0f;
+
+	for (size_t i = 0; i < frameCount; i++) variance += (frameTimes[i] - mean) * (frameTimes[i] - mean);
+
+	return sqrt(variance / frameCount);
+}
+
+const float FramePacer::getPercentile(const double& percentile)
+{
+	if (frameCount == 0) return 0.0f;
+
+	vector<Int64> sorted(frameTimes.begin(), frameTimes.begin() + frameCount);
+	const auto nth = sorted.begin() + min(static_cast<size_t>(frameCount * percentile), frameCount - 1);
+
+	nth_element(sorted.begin(), nth, sorted.end());
+
+	return static_cast<float>(*nth);
+}
+
+string FramePacer::getSummary()
+{
+	stringstream summary;
+	summary << fixed << setprecision(2)
+		<< "frame " << getMean() / 1000.0f << " ms"
+		<< "  sd " << getStandardDeviation() / 1000.0f
+		<< "  p1 " << getPercentile(0.01) / 1000.0f
+		<< "  p99 " << getPercentile(0.99) / 1000.0f
+		<< "  margin " << sleepMargin / 1000.0f << " ms";
+
+	return summary.str();
+}
+
+void FramePacer::adaptSleepMargin(const Int64& oversleep)
+{
+	// Grow straight to a bad oversleep, shrink back slowly once the scheduler behaves
+	if (oversleep > sleepMargin) sleepMargin = oversleep;
+	else sleepMargin -= (sleepMargin - max<Int64>(oversleep, 0)) / 16;
+
+	sleepMargin = clamp(sleepMargin, minSleepMargin, maxSleepMargin);
+}
@@ -0,0 +1,51 @@
+#pragma once
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <string>
+
+using namespace sf;
+using namespace std;
+
+enum class PacingMode {
+	UNLIMITED,
+	SLEEP,
+	HYBRID,
+	VSYNC
+};
+
+class FramePacer {
+public:
+	static void init(RenderWindow& window, const PacingMode& mode, const int& framerate);
+
+	static void waitUntil(const Int64& target);
+	static void endFrame();
+
+	static const Int64 now();
+	static const Int64 getNextDeadline();
+	static const Int64 getSleepMargin();
+
+	static const float getMean();
+	static const float getStandardDeviation();
+	static const float getPercentile(const double& percentile);
+
+	static string getSummary();
+private:
+	static void adaptSleepMargin(const Int64& oversleep);
+
+	static PacingMode mode;
+	static Int64 framePeriod;
+	static Int64 nextDeadline;
+	static Int64 lastFrameEnd;
+	static Int64 sleepMargin;
+
+	static vector<Int64> frameTimes;
+	static size_t frameIndex;
+	static size_t frameCount;
+
+	static Clock clock;
+};
+
+#endif
@@ -13,6 +13,15 @@
 #include "GamePause.h"
 #include "DeathScreen.h"
 #include "BlackHole.h"
+#include "FlowField.h"
+#include "Gravity.h"
+#include "Shockwaves.h"
+#include "Behaviours.h"
+#include "StatusEffects.h"
+#include "Tweens.h"
+#include "CommandBuffer.h"
+#include "Projectiles.h"
+#include "ContactSolver.h"
 
 GameState Game::gameState{ MENU };
 bool Game::hitboxesVisibility{ false };
@@ -21,12 +30,24 @@ Page* Game::currentPage = nullptr;
 
 list<Entity*> Game::entities;
 list<Particle*> Game::particles;
+CircleBatch Game::enemyBatch;
+SpatialGrid Game::enemyGrid;
+
+const float enemyGridCellSize = 128.0f;
 int Game::maxLevel{0};
 int Game::level{0};
 
 Effect Game::freeze{};
 Effect Game::enemySpawn{};
 
+const unordered_map<GameState, vector<string>> nextBackgrounds{
+    { MENU_LOADING, { "menu" } },
+    { MENU, { "background" } },
+    { MENU_HIGHSCORE, { "menu" } },
+    { PLAYING, { "gameover" } },
+    { GAME_OVER, { "menu" } }
+};
+
 Game::Game() {}
 
 void Game::init() {
@@ -37,11 +58,13 @@ void Game::init() {
 
     maxLevel = gd.max_level;
     level = gd.starting_level;
-    freeze = { td.default_freeze_time, false };
-    enemySpawn = { td.default_enemy_spawn_time, false };
+    freeze = { td.default_freeze_time, false, GameClock::GAME };
+    enemySpawn = { td.default_enemy_spawn_time, false, GameClock::WORLD };
 }
 
 void Game::addEntity(Entity* entity) {
+    if (const auto buffer = CommandBuffer::getRecording()) return buffer->record([entity]() { addEntity(entity); });
+
     entities.push_front(entity);
 }
 
@@ -56,6 +79,26 @@ void Game::foreachEntity(const function<void(Entity*)>& callback)
     }
 }
 
+void Game::updateEnemyBatch()
+{
+    enemyBatch.clear();
+
+    for (auto& entity : entities)
+        if (entity->isActive() && entity->getEntityType() == EntityType::TYPE_ENEMY) enemyBatch.add(entity);
+
+    enemyGrid.build(enemyBatch.x, enemyBatch.y, enemyGridCellSize);
+}
+
+const CircleBatch& Game::getEnemyBatch()
+{
+    return enemyBatch;
+}
+
+const SpatialGrid& Game::getEnemyGrid()
+{
+    return enemyGrid;
+}
+
 void Game::removeEntity(Entity* entity) {
     entities.remove_if([entity](Entity* e) {
         if (e == entity) {
@@ -69,6 +112,7 @@ void Game::removeEntity(Entity* entity) {
 
 void Game::replaceEntity(Entity* entity1, Entity* entity2)
 {
+    entity1->setActive(false);
     entities.remove(entity1);
 
     entities.push_front(entity2);
@@ -76,6 +120,14 @@ void Game::replaceEntity(Entity* entity1, Entity* entity2)
 
 void Game::clearEntities(){
     entities.clear();
+    Projectiles::clear();
+    FlowField::clear();
+    Gravity::clear();
+    Shockwaves::clear();
+    Behaviours::clear();
+    StatusEffects::clear();
+    Tweens::clear();
+    ContactSolver::clear();
 }
 
 Entity* Game::doesEntityExist(EntityType type) {
@@ -100,14 +152,15 @@ Entity* Game::findEntity(Sprites spriteType) {
 Entity* Game::getRandomEntity(const int& startIndex, const int& endIndex) {
     const auto ed = FileMenager::enemiesData;
 
+    // Only the rolled enemy gets constructed
     const vector<EnemySpawn> enemiesList = {
-        {new Tower(), ed.enemy_tower_spawn_chance, false},
-        {new Strauner(), ed.enemy_strauner_spawn_chance, true},
-        {new Invader(), ed.enemy_invader_spawn_chance, false},
-        {new BlackHole(), ed.enemy_blackhole_spawn_chance, false},
-        {new Comet(), ed.enemy_comet_spawn_chance, true},
-        {new MultiAsteroid(), ed.enemy_multiasteroid_spawn_chance, false},
-        {new SingleAsteroid(), ed.enemy_singleasteroid_spawn_chance, false}
+        {[]() { return new Tower(); }, Sprites::TOWER, ed.enemy_tower_spawn_chance, false},
+        {[]() { return new Strauner(); }, Sprites::STRAUNER, ed.enemy_strauner_spawn_chance, true},
+        {[]() { return new Invader(); }, Sprites::INVADER, ed.enemy_invader_spawn_chance, false},
+        {[]() { return new BlackHole(); }, Sprites::BLACKHOLE, ed.enemy_blackhole_spawn_chance, false},
+        {[]() { return new Comet(); }, Sprites::COMET, ed.enemy_comet_spawn_chance, true},
+        {[]() { return new MultiAsteroid(); }, Sprites::MULTI_ASTEROID, ed.enemy_multiasteroid_spawn_chance, false},
+        {[]() { return new SingleAsteroid(); }, Sprites::SINGLE_ASTEROID, ed.enemy_singleasteroid_spawn_chance, false}
     };
     
     if (startIndex < 0 || endIndex >= enemiesList.size() || startIndex > endIndex) {
@@ -123,17 +176,17 @@ Entity* Game::getRandomEntity(const int& startIndex, const int& endIndex) {
 
     double cumulativeChance = 0.0;
     for (int i = startIndex; i <= endIndex; ++i) {
-        const auto& [entity, chance, onlyOne] = enemiesList[i];
+        const auto& [create, spriteType, chance, onlyOne] = enemiesList[i];
         cumulativeChance += chance;
 
         if (dice <= cumulativeChance) {
             if (onlyOne) {
-                if (findEntity(entity->spriteInfo.spriteType) == nullptr) {
-                    return entity;
+                if (findEntity(spriteType) == nullptr) {
+                    return create();
                 }
             }
             else {
-                return entity;
+                return create();
             }
         }
     }
@@ -147,6 +200,8 @@ list<Particle*> Game::getParticles()
 }
 
 void Game::addParticle(Particle* particle){
+    if (const auto buffer = CommandBuffer::getRecording()) return buffer->record([particle]() { addParticle(particle); });
+
     particles.push_front(particle);
 }
 
@@ -166,16 +221,6 @@ void Game::clearParticles() {
     particles.clear();
 }
 
-const bool Game::isEntityInsideGruop(Entity* entity, const vector<Sprites>& group)
-{
-    return ranges::find(group, entity->getSpriteType()) != group.end();
-}
-
-const bool Game::isEntityInsideGruop(Entity* entity, const vector<EntityType>& group)
-{
-    return ranges::find(group, entity->getEntityType()) != group.end();
-}
-
 GameState Game::getGameState()
 {
     return gameState;
@@ -200,13 +245,14 @@ void Game::setGameState(const GameState& newGameState){
         break;
     }
     gameState = newGameState;
+
+    if (nextBackgrounds.contains(gameState))
+        for (const auto& backgroundname : nextBackgrounds.at(gameState)) Page::preload(backgroundname);
 }
 
-void Game::spawnEnemy(const float& deltaTime) {
+void Game::spawnEnemy(const float&) {
 	if (gameState != PLAYING && gameState != FREZZE && gameState != WIND) return;
 
-	enemySpawn.updateEffectDuration(deltaTime);
-
 	if (enemySpawn.getEffectDuration() <= 0 && !freeze.isEffectActive()) {
         const auto entity = getRandomEntity(maxLevel - level, maxLevel - 1);
 
@@ -221,13 +267,15 @@ void Game::setCurrentPage(Page* newPage)
     currentPage = newPage;
 }
 
-void Game::runCurrentPage(float deltaTime, RenderWindow& window)
+void Game::runCurrentPage(float deltaTime, RenderList& window)
 {
     if (!currentPage) return;
 
     currentPage->run(deltaTime, window);
 }
 
-void Game::navigate(Event& e){
-    currentPage->navigator(e);
+void Game::navigate(const InputSnapshot& input){
+    if (!currentPage) return;
+
+    currentPage->navigator(input);
 }
\ No newline at end of file
@@ -12,6 +12,10 @@
 #include <ranges>
 #include <functional>
 #include "Effect.h"
+#include "Input.h"
+#include "RenderList.h"
+#include "Narrowphase.h"
+#include "SpatialGrid.h"
 
 using namespace std;
 
@@ -32,7 +36,8 @@ enum GameState {
 };
 
 struct EnemySpawn {
-	Entity* entity;
+	function<Entity*()> create;
+	Sprites spriteType;
 	double chance;
 	bool onlyOneTheSameTime;
 };
@@ -60,15 +65,17 @@ public:
 	static Entity* doesEntityExist(EntityType type);
 	static void foreachEntity(const function<void(Entity*)>& callback);
 
+	static void updateEnemyBatch();
+	static const CircleBatch& getEnemyBatch();
+	static const SpatialGrid& getEnemyGrid();
+
 	static GameState getGameState();
 	static void setGameState(const GameState& newGameState);
 
 	static void setCurrentPage(Page* newPage);
-	static void runCurrentPage(float deltaTime, RenderWindow& window);
-	static void navigate(Event& e);
+	static void runCurrentPage(float deltaTime, RenderList& window);
+	static void navigate(const InputSnapshot& input);
 
-	static const bool isEntityInsideGruop(Entity* entity, const vector<Sprites>& group);
-	static const bool isEntityInsideGruop(Entity* entity, const vector<EntityType>& group);
 
 	static void spawnEnemy(const float& deltaTime);
 
@@ -80,6 +87,8 @@ public:
 private:
 	static list<Entity*> entities;
 	static list<Particle*> particles;	
+	static CircleBatch enemyBatch;
+	static SpatialGrid enemyGrid;
 	
 	static unordered_map<Groups, vector<Sprites>> groups;
 
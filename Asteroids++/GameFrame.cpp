@@ -5,8 +5,29 @@
 #include "GamePause.h"
 #include "WindowBox.h"
 #include "Pickup.h"
+#include "InputLatency.h"
+#include "FramePacer.h"
+#include "QualityGovernor.h"
+#include "JobSystem.h"
+#include "CommandBuffer.h"
+#include "Kinematics.h"
+#include "Projectiles.h"
+#include "CollisionMatrix.h"
+#include "ContactSolver.h"
+#include "AIScheduler.h"
+#include "FlowField.h"
+#include "Flocking.h"
+#include "Gravity.h"
+#include "Shockwaves.h"
+#include "Behaviours.h"
+#include "StatusEffects.h"
+#include "Timers.h"
+#include "Tweens.h"
 
 TextField GameFrame::fps{ 0 };
+TextField GameFrame::latency{ 0 };
+TextField GameFrame::pacing{ 0 };
+TextField GameFrame::quality{ 0 };
 Wind* GameFrame::wind = nullptr;
 GamePause* GameFrame::gamePause = nullptr;
 
@@ -15,7 +36,7 @@ GameFrame::GameFrame() : Page("background")
 	init();
 }
 
-void GameFrame::run(const float& deltaTime, RenderWindow& window)
+void GameFrame::run(const float& deltaTime, RenderList& window)
 {
     Page::run(deltaTime, window);
 
@@ -24,62 +45,47 @@ void GameFrame::run(const float& deltaTime, RenderWindow& window)
 
     renderUI(window);
 
+    window.setLayer(RenderLayer::OVERLAY);
+
     wind->init(deltaTime, window);
     gamePause->init(deltaTime, window);
 }
 
-void GameFrame::navigator(Event& e) {
-    if (WindowBox::isKeyPressed) return;
-
+void GameFrame::navigator(const InputSnapshot& input) {
     if (Game::getGameState() == PAUSED) {
-        gamePause->navigator(e);
+        gamePause->navigator(input);
         return;
     }
 
-    if (FileMenager::gameData.debug_mode == 0) {
-
-        if (e.key.code == Keyboard::P) {
-            gamePause->setPrevGameState();
-            SoundData::modifySound(Sounds::AMBIENT);
-            SoundData::modifySound(Sounds::WIND);
-            Game::setGameState(PAUSED);
-        }
-        WindowBox::isKeyPressed = true;
+    if (input.isPressed(Action::PAUSE)) {
+        gamePause->setPrevGameState();
+        SoundData::modifySound(Sounds::AMBIENT);
+        SoundData::modifySound(Sounds::WIND);
+        Game::setGameState(PAUSED);
         return;
     }
 
-    switch (e.key.code)
-    {
-    case Keyboard::H:
-        Game::hitboxesVisibility = !Game::hitboxesVisibility;
-        break;
-    case Keyboard::Num7:
-        Game::addEntity(new Pickup(physics::getRandomPosition(32)));
-        break;
-    case Keyboard::Num8:
+    if (FileMenager::gameData.debug_mode == 0) return;
+
+    if (input.isPressed(Action::DEBUG_HITBOXES)) Game::hitboxesVisibility = !Game::hitboxesVisibility;
+
+    if (input.isPressed(Action::DEBUG_PICKUP)) Game::addEntity(new Pickup(physics::getRandomPosition(32)));
+
+    if (input.isPressed(Action::DEBUG_BULLETS)) {
         Player::playerStats.bulletAmount += 1;
         if (Player::playerStats.bulletAmount == 5) Player::playerStats.bulletAmount = 1;
-        break;
-    case Keyboard::Num9:
-        wind->forceWind(10.0f, 4.0f, physics::getRandomDirection());
-        break;
-    case Keyboard::Num0:
+    }
+
+    if (input.isPressed(Action::DEBUG_WIND)) wind->forceWind(10.0f, 4.0f, physics::getRandomDirection());
+
+    if (input.isPressed(Action::DEBUG_FREEZE)) {
         if (SoundData::sounds[Sounds::AMBIENT].getStatus() != Sound::Playing) {
             SoundData::recoverSound(Sounds::AMBIENT);
             SoundData::renev(Sounds::AMBIENT);
         }
         Game::freeze.startEffect(physics::getRandomFloatValue(5.0f, 0.5f) + Player::playerStats.time);
         Game::setGameState(FREZZE);
-        break;
-    case Keyboard::P:
-        gamePause->setPrevGameState();
-        SoundData::modifySound(Sounds::AMBIENT);
-        SoundData::modifySound(Sounds::WIND);
-        Game::setGameState(PAUSED);
-        break;
     }
-
-    WindowBox::isKeyPressed = true;
 }
 
 void GameFrame::init()
@@ -96,13 +102,24 @@ void GameFrame::init()
     fps.setColorText(Color(255, 255, 255, 150));
     fps.setSize(FileMenager::screenData.fps_font_size);
 
+    latency.setColorText(Color(255, 255, 255, 150));
+    latency.setSize(FileMenager::screenData.fps_font_size);
+
+    pacing.setColorText(Color(255, 255, 255, 150));
+    pacing.setSize(FileMenager::screenData.fps_font_size);
+
+    quality.setColorText(Color(255, 255, 255, 150));
+    quality.setSize(FileMenager::screenData.fps_font_size);
+
+    InputLatency::reset();
+
     Score::init();
 
     wind = new Wind();
     gamePause = new GamePause();
 }
 
-void GameFrame::renderUI(RenderWindow& window)
+void GameFrame::renderUI(RenderList& window)
 {
     Score::scoreText.setText(Score::getScoreString());
     window.draw(Score::scoreText.getText());
@@ -115,13 +132,12 @@ void GameFrame::renderUI(RenderWindow& window)
     dashBar.draw(window);
 }
 
-void GameFrame::updateWindow(const float& deltaTime, RenderWindow& window)
+void GameFrame::updateWindow(const float& deltaTime, RenderList& window)
 {
     for (auto& particle : Game::getParticles())
     {
         if (!particle->isActive()) continue;
 
-        particle->render(window);
         particle->update(deltaTime);
     }
 
@@ -129,17 +145,38 @@ void GameFrame::updateWindow(const float& deltaTime, RenderWindow& window)
     if (!SoundData::isSoundPlaying(Sounds::AMBIENT) && Game::getGameState() == PLAYING) SoundData::renev(Sounds::AMBIENT);
     if (SoundData::isSoundPlaying(Sounds::WIND) && !wind->isActive()) SoundData::stop(Sounds::WIND);
 
+    vector<Entity*> updated;
+
     for (auto& entity : Game::getEntities())
     {
         if (!entity || !entity->isActive() || (DeathScreen::isScreenOver() && entity->getEntityType() == TYPE_PLAYER)) continue;
 
-        entity->render(window);
+        if (Game::getGameState() == DEATH && entity->getEntityType() != TYPE_EXPLOSION || Game::getGameState() == PAUSED) continue;
 
-        if (Game::getGameState() == DEATH && entity->getEntityType() != TYPE_EXPLOSION && entity->getEntityType() != TYPE_ENEMY_BULLET && entity->getEntityType() != TYPE_BULLET_SINGLE || Game::getGameState() == PAUSED) continue;
+        updated.push_back(entity);
+    }
 
-        entity->update(deltaTime);
+    updateEntities(updated, deltaTime);
+
+    // Draw only once everything has moved, so the frame shows a single point in time
+    window.setLayer(RenderLayer::PARTICLES);
+
+    for (auto& particle : Game::getParticles())
+        if (particle->isActive()) particle->render(window);
+
+    window.setLayer(RenderLayer::ENTITIES);
+
+    for (auto& entity : Game::getEntities())
+    {
+        if (!entity || !entity->isActive() || (DeathScreen::isScreenOver() && entity->getEntityType() == TYPE_PLAYER)) continue;
+
+        entity->render(window);
     }
 
+    Projectiles::render(window);
+
+    window.setLayer(RenderLayer::UI);
+
     for (auto& life : Player::playerStats.lifes) {
         life.update(deltaTime);
         life.draw(window);
@@ -153,7 +190,86 @@ void GameFrame::updateWindow(const float& deltaTime, RenderWindow& window)
         fps.setText(to_string(static_cast<int>(1.0f / (deltaTime - lastTime))) + " FPS");
         fps.setTextPosition(Vector2f(FileMenager::screenData.fps_pos_x + FileMenager::screenData.padding, FileMenager::screenData.fps_pos_y + FileMenager::screenData.padding));
         lastTime = deltaTime;
+
+        latency.setText(InputLatency::getSummary());
+        latency.setTextPosition(Vector2f(fps.getText().getPosition().x, fps.getText().getPosition().y + FileMenager::screenData.fps_font_size * 1.5f));
+
+        pacing.setText(FramePacer::getSummary());
+        pacing.setTextPosition(Vector2f(fps.getText().getPosition().x, fps.getText().getPosition().y + FileMenager::screenData.fps_font_size * 3.0f));
+
+        quality.setText(QualityGovernor::getSummary());
+        quality.setTextPosition(Vector2f(fps.getText().getPosition().x, fps.getText().getPosition().y + FileMenager::screenData.fps_font_size * 4.5f));
     }
 
     window.draw(fps.getText());
+    if (FileMenager::gameData.debug_mode) {
+        window.draw(latency.getText());
+        window.draw(pacing.getText());
+        window.draw(quality.getText());
+    }
+}
+
+void GameFrame::updateEntities(const vector<Entity*>& entities, const float& deltaTime)
+{
+    const auto chunks = JobSystem::getChunkCount();
+
+    Timers::update(deltaTime);
+    AIScheduler::beginFrame(deltaTime);
+
+    // One buffer per chunk and phase, applied in entity order so the result doesn't depend on scheduling
+    vector<CommandBuffer> buffers(chunks * 2);
+
+    JobSystem::parallelFor(entities.size(), [&](const size_t& begin, const size_t& end, const size_t& chunk) {
+        CommandBuffer::beginRecording(&buffers[chunk]);
+        for (auto i = begin; i < end; i++) entities[i]->think();
+        CommandBuffer::endRecording();
+    });
+
+    JobSystem::parallelFor(entities.size(), [&](const size_t& begin, const size_t& end, const size_t& chunk) {
+        CommandBuffer::beginRecording(&buffers[chunks + chunk]);
+        for (auto i = begin; i < end; i++) entities[i]->integrate(deltaTime);
+        CommandBuffer::endRecording();
+    });
+
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED) Kinematics::integrate(deltaTime);
+    Kinematics::publish();
+
+    // Enemies are only ever replaced during a frame, never deleted, so the pointers stay valid until the next one
+    Game::updateEnemyBatch();
+
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED && !Game::freeze.isEffectActive()) Gravity::update();
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED) Shockwaves::apply();
+
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED) FlowField::update(deltaTime);
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED && !Game::freeze.isEffectActive()) Flocking::update();
+
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED && !Game::freeze.isEffectActive()) ContactSolver::detect();
+
+    // Bullets fired this frame only start moving on the next one, like spawned entities
+    if (Game::getGameState() != PAUSED) Projectiles::update(deltaTime);
+
+    if (Game::getGameState() != PAUSED && !Game::freeze.isEffectActive()) {
+        Behaviours::update();
+        StatusEffects::update(deltaTime);
+    }
+
+    // Tracks follow their own clock, the player's run on through a freeze
+    Tweens::update();
+
+    for (auto& entity : entities)
+    {
+        if (!entity->isActive()) continue;
+
+        entity->update(deltaTime);
+    }
+
+    // Enemies also move in update, so the player is tested against where they ended up
+    Game::updateEnemyBatch();
+
+    if (Game::getGameState() != DEATH && Game::getGameState() != PAUSED && !DeathScreen::isScreenOver())
+        if (auto player = Game::doesEntityExist(TYPE_PLAYER); player && player->isActive()) player->collisionDetection();
+
+    CollisionMatrix::dispatch();
+
+    for (auto& buffer : buffers) buffer.apply();
 }
\ No newline at end of file
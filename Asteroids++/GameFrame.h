@@ -15,21 +15,25 @@ class GameFrame : public Page
 public:
 	GameFrame();
 
-	void run(const float& deltaTime, RenderWindow& window) override;
-	void navigator(Event& e) override;
+	void run(const float& deltaTime, RenderList& window) override;
+	void navigator(const InputSnapshot& input) override;
 
 private:
 	static Wind* wind;
 	static GamePause* gamePause;
 
 	static TextField fps;
+	static TextField latency;
+	static TextField pacing;
+	static TextField quality;
 	Effect fpsDelay;
 
 	void init() override;
 
-	void renderUI(RenderWindow& window);
+	void renderUI(RenderList& window);
 
-	void updateWindow(const float& deltaTime, RenderWindow& window);
+	void updateWindow(const float& deltaTime, RenderList& window);
+	void updateEntities(const vector<Entity*>& entities, const float& deltaTime);
 };
 
 #endif
\ No newline at end of file
@@ -29,7 +29,7 @@ void GameOver::init()
     underscore.setText("_");
 }
 
-void GameOver::drawPlayerName(RenderWindow& window) {
+void GameOver::drawPlayerName(RenderList& window) {
     const auto offset = 10.0f;
 
     float centerX = (WindowBox::getVideoMode().width - underscore.getText().getGlobalBounds().width * 12 - offset * 11) / 2.0f;
@@ -44,7 +44,7 @@ void GameOver::drawPlayerName(RenderWindow& window) {
     window.draw(playerNameText.getText());
 }
 
-void GameOver::run(const float& deltaTime, RenderWindow& window)
+void GameOver::run(const float& deltaTime, RenderList& window)
 {
     Page::run(deltaTime, window);
 
@@ -53,14 +53,14 @@ void GameOver::run(const float& deltaTime, RenderWindow& window)
     drawPlayerName(window);
 }
 
-void GameOver::navigator(Event& e)
+void GameOver::navigator(const InputSnapshot& input)
 {
-    if (e.type == Event::TextEntered) {
-        if (e.text.unicode == '\b' && !playerName.empty()) {
+    for (const auto& character : input.text) {
+        if (character == '\b' && !playerName.empty()) {
             playerName.pop_back();
         }
-        else if (e.text.unicode < 128 && e.text.unicode != '\r') {
-            string newChar(1, static_cast<char>(e.text.unicode));
+        else if (character != '\r') {
+            string newChar(1, character);
             if (playerName.size() < 13 && regex_match(newChar, regex("[A-Za-z0-9]+"))) {
                 playerName += newChar;
             }
@@ -71,7 +71,7 @@ void GameOver::navigator(Event& e)
 
     if (playerNameText.getText().getString().isEmpty()) return;
 
-    if (Keyboard::isKeyPressed(Keyboard::Enter) && !WindowBox::isKeyPressed) {
+    if (input.isPressed(Action::CONFIRM)) {
         FileMenager::saveData("highscore.txt", pair<string, size_t>(playerName, Score::getScore()));
         FileMenager::highScore = FileMenager::sortMapByFloat(FileMenager::getDataFromFile("highscore.txt"));
 
@@ -82,7 +82,5 @@ void GameOver::navigator(Event& e)
         Game::clearParticles();
         Game::level = FileMenager::gameData.starting_level;
         Player::playerStats.lifes.clear();
-
-        WindowBox::isKeyPressed = true;
     }
 }
\ No newline at end of file
@@ -16,12 +16,12 @@ public:
 
 	TextField playerNameText;
 
-	void run(const float& deltaTime, RenderWindow& window) override;
-	void navigator(Event& e) override;
+	void run(const float& deltaTime, RenderList& window) override;
+	void navigator(const InputSnapshot& input) override;
 
 private:
 	void init() override;
-	void drawPlayerName(RenderWindow& window);
+	void drawPlayerName(RenderList& window);
 
 	TextField gameOver;
 	TextField underscore;
@@ -51,7 +51,7 @@ const EntityType GamePause::getEntityType()
 	return EntityType();
 }
 
-void GamePause::init(const float& deltaTime, RenderWindow& window)
+void GamePause::init(const float& deltaTime, RenderList& window)
 {
 	if (Game::getGameState() != PAUSED) return;
 
@@ -101,24 +101,18 @@ void GamePause::moveRight() {
 	selectedOption = 0;
 }
 
-void GamePause::navigator(Event& e)
+void GamePause::navigator(const InputSnapshot& input)
 {
-	if (WindowBox::isKeyPressed) return;
-
-	if (Keyboard::isKeyPressed(Keyboard::Right)) {
+	if (input.isPressed(Action::RIGHT)) {
 		moveRight();
 		SoundData::play(Sounds::PING);
-
-		WindowBox::isKeyPressed = true;
 	}
-	if (Keyboard::isKeyPressed(Keyboard::Left)) {
+	if (input.isPressed(Action::LEFT)) {
 		moveLeft();
 		SoundData::play(Sounds::PING);
-
-		WindowBox::isKeyPressed = true;
 	}
 
-	if (Keyboard::isKeyPressed(Keyboard::Enter)) {
+	if (input.isPressed(Action::CONFIRM)) {
 		switch (selectedOption) {
 		case 0:
 			Game::setGameState(prevGameState);
@@ -141,8 +135,6 @@ void GamePause::navigator(Event& e)
 			WindowBox::close();
 			break;
 		}
-
-		WindowBox::isKeyPressed = true;
 	}
 }
 
@@ -17,10 +17,10 @@ public:
 
 	void update(float deltaTime) override;
 	const EntityType getEntityType() override;
-	void init(const float& deltaTime, RenderWindow& window) override;
+	void init(const float& deltaTime, RenderList& window) override;
 	void initParticles() override;
 
-	void navigator(Event& e);
+	void navigator(const InputSnapshot& input);
 
 	void setPrevGameState();
 private:
@@ -0,0 +1,180 @@
+#include "Gravity.h"
+#include "Game.h"
+#include "BlackHole.h"
+#include "CollisionMatrix.h"
+#include "Narrowphase.h"
+#include <algorithm>
+#include <cmath>
+
+const float theta = 0.5f;
+const float softening = 32.0f;
+const int maxDepth = 16;
+
+vector<float> Gravity::x;
+vector<float> Gravity::y;
+vector<float> Gravity::masses;
+vector<GravityNode> Gravity::nodes;
+
+void Gravity::update()
+{
+	merge();
+	build();
+}
+
+void Gravity::clear()
+{
+	x.clear();
+	y.clear();
+	masses.clear();
+	nodes.clear();
+}
+
+const bool Gravity::hasAttractors()
+{
+	return !nodes.empty();
+}
+
+const Vector2f Gravity::getAcceleration(const Vector2f& position)
+{
+	if (nodes.empty()) return Vector2f();
+
+	const auto strength = FileMenager::enemiesData.enemy_blackhole_gravity;
+	Vector2f acceleration;
+
+	int stack[maxDepth * 3 + 4];
+	int top = 0;
+	stack[top++] = 0;
+
+	while (top > 0) {
+		const auto& node = nodes[stack[--top]];
+
+		const auto dx = node.massX - position.x;
+		const auto dy = node.massY - position.y;
+		const auto distanceSquared = dx * dx + dy * dy;
+		const auto width = node.halfSize * 2;
+
+		// Leaves and squares small enough from here count as a single mass at their center
+		if (node.firstChild == -1 || width * width < theta * theta * distanceSquared) {
+			const auto softened = distanceSquared + softening * softening;
+			const auto pull = strength * node.mass / (softened * sqrt(softened));
+
+			acceleration += Vector2f(dx, dy) * pull;
+			continue;
+		}
+
+		for (int child = node.firstChild; child < node.firstChild + 4; child++)
+			if (nodes[child].count > 0) stack[top++] = child;
+	}
+
+	return acceleration;
+}
+
+void Gravity::build()
+{
+	x.clear();
+	y.clear();
+	masses.clear();
+	nodes.clear();
+
+	const auto& enemies = Game::getEnemyBatch();
+	for (size_t i = 0; i < enemies.size(); i++) {
+		const auto entity = enemies.entities[i];
+		if (entity->layer != LAYER_BLACKHOLE || !entity->isActive()) continue;
+
+		x.push_back(entity->position.x);
+		y.push_back(entity->position.y);
+		masses.push_back(entity->size);
+	}
+
+	if (x.empty()) return;
+
+	const auto [minX, maxX] = minmax_element(x.begin(), x.end());
+	const auto [minY, maxY] = minmax_element(y.begin(), y.end());
+
+	GravityNode root;
+	root.centerX = (*minX + *maxX) / 2;
+	root.centerY = (*minY + *maxY) / 2;
+	root.halfSize = max(max(*maxX - *minX, *maxY - *minY) / 2, 1.0f);
+	nodes.push_back(root);
+
+	for (int body = 0; body < int(x.size()); body++) insert(0, body, 0);
+
+	for (auto& node : nodes) {
+		if (node.mass <= 0.0f) continue;
+
+		node.massX /= node.mass;
+		node.massY /= node.mass;
+	}
+}
+
+void Gravity::insert(const int& node, const int& body, const int& depth)
+{
+	nodes[node].mass += masses[body];
+	nodes[node].massX += x[body] * masses[body];
+	nodes[node].massY += y[body] * masses[body];
+
+	if (++nodes[node].count == 1) {
+		nodes[node].body = body;
+		return;
+	}
+
+	if (nodes[node].firstChild == -1) {
+		// Bodies sitting on top of each other stay merged in one leaf
+		if (depth >= maxDepth) return;
+
+		const auto half = nodes[node].halfSize / 2;
+		const auto centerX = nodes[node].centerX;
+		const auto centerY = nodes[node].centerY;
+
+		nodes[node].firstChild = int(nodes.size());
+
+		for (int quadrant = 0; quadrant < 4; quadrant++) {
+			GravityNode child;
+			child.centerX = centerX + (quadrant & 1 ? half : -half);
+			child.centerY = centerY + (quadrant & 2 ? half : -half);
+			child.halfSize = half;
+			nodes.push_back(child);
+		}
+
+		const auto previous = nodes[node].body;
+		nodes[node].body = -1;
+
+		insert(getChild(node, x[previous], y[previous]), previous, depth + 1);
+	}
+
+	insert(getChild(node, x[body], y[body]), body, depth + 1);
+}
+
+const int Gravity::getChild(const int& node, const float& pointX, const float& pointY)
+{
+	const auto& parent = nodes[node];
+
+	return parent.firstChild + (pointX >= parent.centerX ? 1 : 0) + (pointY >= parent.centerY ? 2 : 0);
+}
+
+// Touching black holes become one, the bigger one takes in the smaller
+void Gravity::merge()
+{
+	const auto& enemies = Game::getEnemyBatch();
+
+	CircleBatch holes;
+	for (size_t i = 0; i < enemies.size(); i++)
+		if (enemies.entities[i]->layer == LAYER_BLACKHOLE && enemies.entities[i]->isActive()) holes.add(enemies.entities[i]);
+
+	if (holes.size() < 2) return;
+
+	vector<pair<size_t, size_t>> hits;
+	Narrowphase::query(holes, holes, hits);
+
+	for (const auto& [i, j] : hits)
+	{
+		if (i >= j || !holes.entities[i]->isActive() || !holes.entities[j]->isActive()) continue;
+
+		auto first = static_cast<BlackHole*>(holes.entities[i]);
+		auto second = static_cast<BlackHole*>(holes.entities[j]);
+
+		if (first->size < second->size) swap(first, second);
+
+		first->merge(second);
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef GRAVITY_H
+#define GRAVITY_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Square of the quadtree, mass is summed over everything inside and massX/massY hold the center of mass once built
+struct GravityNode {
+	float centerX;
+	float centerY;
+	float halfSize;
+
+	float mass = 0.0f;
+	float massX = 0.0f;
+	float massY = 0.0f;
+
+	int firstChild = -1;
+	int body = -1;
+	int count = 0;
+};
+
+// Black holes pull on everything through a Barnes-Hut quadtree, far groups of them act as one mass
+class Gravity {
+public:
+	static void update();
+	static void clear();
+
+	static const bool hasAttractors();
+	static const Vector2f getAcceleration(const Vector2f& position);
+private:
+	static void build();
+	static void insert(const int& node, const int& body, const int& depth);
+	static const int getChild(const int& node, const float& x, const float& y);
+
+	static void merge();
+
+	static vector<float> x;
+	static vector<float> y;
+	static vector<float> masses;
+	static vector<GravityNode> nodes;
+};
+
+#endif
@@ -2,7 +2,7 @@
 #include "Menu.h"
 #include "WindowBox.h"
 
-HighScoreTable::HighScoreTable() : Page("menu"), highscoreText(64), isKeyPressed(false)
+HighScoreTable::HighScoreTable() : Page("menu"), highscoreText(64)
 {
 	init();
 }
@@ -17,7 +17,7 @@ void HighScoreTable::init()
 	FileMenager::highScore = FileMenager::sortMapByFloat(FileMenager::getDataFromFile("highscore.txt"));
 }
 
-void HighScoreTable::run(const float& deltaTime, RenderWindow& window)
+void HighScoreTable::run(const float& deltaTime, RenderList& window)
 {
 	Page::run(deltaTime, window);
 
@@ -47,10 +47,6 @@ void HighScoreTable::run(const float& deltaTime, RenderWindow& window)
 	}
 }
 
-void HighScoreTable::navigator(Event& e) {
-	if (Keyboard::isKeyPressed(Keyboard::Enter) && !WindowBox::isKeyPressed) {
-		Game::setGameState(MENU);
-
-		WindowBox::isKeyPressed = true;
-	}
+void HighScoreTable::navigator(const InputSnapshot& input) {
+	if (input.isPressed(Action::CONFIRM)) Game::setGameState(MENU);
 }
@@ -14,12 +14,11 @@ class HighScoreTable : public Page
 public:
 	HighScoreTable();
 
-	void run(const float& deltaTime, RenderWindow& window) override;
-	void navigator(Event& e) override;
+	void run(const float& deltaTime, RenderList& window) override;
+	void navigator(const InputSnapshot& input) override;
 
 private:
 	void init() override;
-	bool isKeyPressed;
 
 	TextField highscoreText;
 };
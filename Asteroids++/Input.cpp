@@ -0,0 +1,149 @@
+#include "Input.h"
+#include "FileMenager.h"
+
+InputSnapshot Input::current;
+InputSnapshot Input::snapshot;
+array<vector<Keyboard::Key>, ACTION_COUNT> Input::bindings;
+bitset<Keyboard::KeyCount> Input::keys;
+Clock Input::clock;
+
+const vector<pair<string, Action>> actions = {
+	{"turn_left", Action::TURN_LEFT},
+	{"turn_right", Action::TURN_RIGHT},
+	{"thrust", Action::THRUST},
+	{"reverse", Action::REVERSE},
+	{"shoot", Action::SHOOT},
+	{"dash", Action::DASH},
+	{"up", Action::UP},
+	{"down", Action::DOWN},
+	{"left", Action::LEFT},
+	{"right", Action::RIGHT},
+	{"confirm", Action::CONFIRM},
+	{"pause", Action::PAUSE},
+	{"exit", Action::EXIT},
+	{"debug_hitboxes", Action::DEBUG_HITBOXES},
+	{"debug_pickup", Action::DEBUG_PICKUP},
+	{"debug_bullets", Action::DEBUG_BULLETS},
+	{"debug_wind", Action::DEBUG_WIND},
+	{"debug_freeze", Action::DEBUG_FREEZE}
+};
+
+const vector<pair<Action, vector<Keyboard::Key>>> defaultBindings = {
+	{Action::TURN_LEFT, {Keyboard::A}},
+	{Action::TURN_RIGHT, {Keyboard::D}},
+	{Action::THRUST, {Keyboard::W}},
+	{Action::REVERSE, {Keyboard::S}},
+	{Action::SHOOT, {Keyboard::Space}},
+	{Action::DASH, {Keyboard::R}},
+	{Action::UP, {Keyboard::Up}},
+	{Action::DOWN, {Keyboard::Down}},
+	{Action::LEFT, {Keyboard::Left}},
+	{Action::RIGHT, {Keyboard::Right}},
+	{Action::CONFIRM, {Keyboard::Enter}},
+	{Action::PAUSE, {Keyboard::P}},
+	{Action::EXIT, {Keyboard::Escape}},
+	{Action::DEBUG_HITBOXES, {Keyboard::H}},
+	{Action::DEBUG_PICKUP, {Keyboard::Num7}},
+	{Action::DEBUG_BULLETS, {Keyboard::Num8}},
+	{Action::DEBUG_WIND, {Keyboard::Num9}},
+	{Action::DEBUG_FREEZE, {Keyboard::Num0}}
+};
+
+bool InputSnapshot::isDown(const Action& action) const
+{
+	return down.test(static_cast<size_t>(action));
+}
+
+bool InputSnapshot::isPressed(const Action& action) const
+{
+	return pressed.test(static_cast<size_t>(action));
+}
+
+bool InputSnapshot::isReleased(const Action& action) const
+{
+	return released.test(static_cast<size_t>(action));
+}
+
+void Input::init()
+{
+	for (const auto& [action, keys] : defaultBindings) bind(action, keys);
+
+	for (const auto& [name, action] : actions) {
+		if (!FileMenager::keyBindings.contains(name)) continue;
+
+		bind(action, { static_cast<Keyboard::Key>(FileMenager::keyBindings[name]) });
+	}
+}
+
+void Input::poll(RenderWindow& window)
+{
+	current.pressed.reset();
+	current.released.reset();
+	current.text.clear();
+	current.closed = false;
+
+	Event e{};
+
+	while (window.pollEvent(e)) handleEvent(e);
+
+	current.tick++;
+	current.time = clock.getElapsedTime().asSeconds();
+
+	snapshot = current;
+}
+
+const InputSnapshot& Input::getSnapshot()
+{
+	return snapshot;
+}
+
+void Input::bind(const Action& action, const vector<Keyboard::Key>& keys)
+{
+	bindings[static_cast<size_t>(action)] = keys;
+}
+
+void Input::handleEvent(const Event& e)
+{
+	switch (e.type)
+	{
+	case Event::Closed:
+		current.closed = true;
+		break;
+	case Event::TextEntered:
+		if (e.text.unicode < 128) current.text += static_cast<char>(e.text.unicode);
+		break;
+	case Event::LostFocus:
+		// Release events never arrive while unfocused, drop everything held
+		keys.reset();
+		for (size_t i = 0; i < ACTION_COUNT; i++) updateAction(i);
+		break;
+	// OS key repeat is left on for typing, a repeated press finds the action already down and raises no new edge
+	case Event::KeyPressed:
+	case Event::KeyReleased:
+		if (e.key.code < 0 || e.key.code >= Keyboard::KeyCount) break;
+
+		keys.set(e.key.code, e.type == Event::KeyPressed);
+
+		for (size_t i = 0; i < ACTION_COUNT; i++) {
+			if (ranges::find(bindings[i], e.key.code) != bindings[i].end()) updateAction(i);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+void Input::updateAction(const size_t& action)
+{
+	const auto wasDown = current.down.test(action);
+	const auto isDown = ranges::any_of(bindings[action], [](Keyboard::Key key) { return key >= 0 && keys.test(key); });
+
+	current.down.set(action, isDown);
+
+	if (isDown && !wasDown) {
+		current.pressed.set(action);
+		current.pressedAt[action] = clock.getElapsedTime().asSeconds();
+	}
+
+	if (!isDown && wasDown) current.released.set(action);
+}
@@ -0,0 +1,77 @@
+#pragma once
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <string>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+enum class Action {
+	TURN_LEFT,
+	TURN_RIGHT,
+	THRUST,
+	REVERSE,
+	SHOOT,
+	DASH,
+	UP,
+	DOWN,
+	LEFT,
+	RIGHT,
+	CONFIRM,
+	PAUSE,
+	EXIT,
+	DEBUG_HITBOXES,
+	DEBUG_PICKUP,
+	DEBUG_BULLETS,
+	DEBUG_WIND,
+	DEBUG_FREEZE,
+	COUNT
+};
+
+constexpr size_t ACTION_COUNT = static_cast<size_t>(Action::COUNT);
+
+struct InputSnapshot {
+	unsigned long long tick = 0;
+	float time = 0.0f;
+
+	bitset<ACTION_COUNT> down;
+	bitset<ACTION_COUNT> pressed;
+	bitset<ACTION_COUNT> released;
+	array<float, ACTION_COUNT> pressedAt{};
+
+	string text;
+	bool closed = false;
+
+	bool isDown(const Action& action) const;
+	bool isPressed(const Action& action) const;
+	bool isReleased(const Action& action) const;
+};
+
+class Input {
+public:
+	static void init();
+	static void poll(RenderWindow& window);
+
+	static const InputSnapshot& getSnapshot();
+
+	static void bind(const Action& action, const vector<Keyboard::Key>& keys);
+private:
+	static void handleEvent(const Event& e);
+	static void updateAction(const size_t& action);
+
+	static InputSnapshot current;
+	static InputSnapshot snapshot;
+
+	static array<vector<Keyboard::Key>, ACTION_COUNT> bindings;
+	static bitset<Keyboard::KeyCount> keys;
+
+	static Clock clock;
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include "InputLatency.h"
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+const size_t historySize = 256;
+
+FrameRecord InputLatency::current;
+FrameRecord InputLatency::submitted;
+deque<FrameRecord> InputLatency::inFlight;
+vector<FrameRecord> InputLatency::history(historySize);
+size_t InputLatency::historyIndex{ 0 };
+array<unsigned, LATENCY_BUCKETS> InputLatency::histogram{};
+unsigned long long InputLatency::samples{ 0 };
+Int64 InputLatency::estimatedWorkTime{ 0 };
+Clock InputLatency::clock;
+
+const Int64 FrameRecord::getDuration(const FrameMark& from, const FrameMark& to) const
+{
+	return marks[static_cast<size_t>(to)] - marks[static_cast<size_t>(from)];
+}
+
+void InputLatency::mark(const FrameMark& mark)
+{
+	current.marks[static_cast<size_t>(mark)] = now();
+}
+
+void InputLatency::endFrame()
+{
+	submitted = current;
+	inFlight.push_back(current);
+
+	current = FrameRecord();
+}
+
+void InputLatency::frameDisplayed(const Int64& time)
+{
+	if (inFlight.empty()) return;
+
+	auto frame = inFlight.front();
+	inFlight.pop_front();
+
+	frame.marks[static_cast<size_t>(FrameMark::DISPLAY_RETURNED)] = time;
+
+	const auto latency = frame.getDuration(FrameMark::INPUT_SAMPLED, FrameMark::DISPLAY_RETURNED);
+	const auto bucket = min(static_cast<size_t>(max<Int64>(latency, 0) / LATENCY_BUCKET_SIZE), LATENCY_BUCKETS - 1);
+
+	histogram[bucket]++;
+	samples++;
+
+	// Exponential average of the work done after input is sampled, used to schedule late sampling
+	estimatedWorkTime = estimatedWorkTime == 0 ? latency : (estimatedWorkTime * 7 + latency) / 8;
+
+	history[historyIndex] = frame;
+	historyIndex = (historyIndex + 1) % historySize;
+}
+
+void InputLatency::reset()
+{
+	histogram.fill(0);
+	samples = 0;
+}
+
+const Int64 InputLatency::now()
+{
+	return clock.getElapsedTime().asMicroseconds();
+}
+
+const Int64 InputLatency::getPercentile(const double& percentile)
+{
+	if (samples == 0) return 0;
+
+	const auto threshold = static_cast<unsigned long long>(samples * percentile);
+	unsigned long long counted = 0;
+
+	for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+		counted += histogram[i];
+
+		if (counted > threshold) return static_cast<Int64>(i + 1) * LATENCY_BUCKET_SIZE;
+	}
+
+	return static_cast<Int64>(LATENCY_BUCKETS) * LATENCY_BUCKET_SIZE;
+}
+
+const Int64 InputLatency::getEstimatedWorkTime()
+{
+	return estimatedWorkTime;
+}
+
+const FrameRecord& InputLatency::getLastFrame()
+{
+	return history[(historyIndex + historySize - 1) % historySize];
+}
+
+const FrameRecord& InputLatency::getSubmittedFrame()
+{
+	return submitted;
+}
+
+string InputLatency::getSummary()
+{
+	const auto& frame = getLastFrame();
+
+	stringstream summary;
+	summary << fixed << setprecision(1)
+		<< "input " << frame.getDuration(FrameMark::INPUT_SAMPLED, FrameMark::DISPLAY_RETURNED) / 1000.0f << " ms"
+		<< " (sim " << frame.getDuration(FrameMark::INPUT_SAMPLED, FrameMark::SIMULATION_DONE) / 1000.0f
+		<< " / render " << frame.getDuration(FrameMark::SIMULATION_DONE, FrameMark::RENDER_SUBMITTED) / 1000.0f
+		<< " / display " << frame.getDuration(FrameMark::RENDER_SUBMITTED, FrameMark::DISPLAY_RETURNED) / 1000.0f << ")"
+		<< "  p50 " << getPercentile(0.5) / 1000.0f << " ms"
+		<< "  p99 " << getPercentile(0.99) / 1000.0f << " ms";
+
+	return summary.str();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef INPUTLATENCY_H
+#define INPUTLATENCY_H
+
+#include <SFML/System.hpp>
+#include <array>
+#include <vector>
+#include <deque>
+#include <string>
+
+using namespace sf;
+using namespace std;
+
+enum class FrameMark {
+	FRAME_START,
+	INPUT_SAMPLED,
+	SIMULATION_DONE,
+	RENDER_SUBMITTED,
+	DISPLAY_RETURNED,
+	COUNT
+};
+
+constexpr size_t FRAME_MARK_COUNT = static_cast<size_t>(FrameMark::COUNT);
+constexpr size_t LATENCY_BUCKETS = 128;
+constexpr Int64 LATENCY_BUCKET_SIZE = 500;
+
+struct FrameRecord {
+	array<Int64, FRAME_MARK_COUNT> marks{};
+
+	const Int64 getDuration(const FrameMark& from, const FrameMark& to) const;
+};
+
+class InputLatency {
+public:
+	static void mark(const FrameMark& mark);
+	static void reset();
+
+	// A frame is only counted once it was displayed, which can be after the next one was submitted
+	static void endFrame();
+	static void frameDisplayed(const Int64& time);
+
+	static const Int64 now();
+	static const Int64 getPercentile(const double& percentile);
+	static const Int64 getEstimatedWorkTime();
+	static const FrameRecord& getLastFrame();
+	static const FrameRecord& getSubmittedFrame();
+
+	static string getSummary();
+private:
+	static FrameRecord current;
+	static FrameRecord submitted;
+	static deque<FrameRecord> inFlight;
+	static vector<FrameRecord> history;
+	static size_t historyIndex;
+
+	static array<unsigned, LATENCY_BUCKETS> histogram;
+	static unsigned long long samples;
+
+	static Int64 estimatedWorkTime;
+
+	static Clock clock;
+};
+
+#endif
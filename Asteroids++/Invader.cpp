@@ -1,69 +1,111 @@
 #include "Invader.h"
 #include "WindowBox.h"
-#include "EnemyBullet.h"
+#include "Patterns.h"
 #include "Pickup.h"
 
+const float waypointInterval = 5.0f;
+
 Invader::Invader() : Enemy(500.0f + 60.0f * floor(Score::getScore() / FileMenager::screenData.game_next_level_spike), physics::getRandomFloatValue(FileMenager::enemiesData.asteroid_speed) + 150.0f, getSprite(Sprites::INVADER)),
-changePosition(5.0f, false),
-shoot(0.0f, false)
+newPosition(physics::getRandomPosition(radius)),
+waypointDue(0.0),
+directionToPlayer(direction),
+slightlyOffDirection(direction),
+aimAngle(angle),
+bulletAngle(angle),
+arrived(false)
 {
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 
 	drawHitboxes();
+
+	Behaviours::start(this, attack());
 }
 
-void Invader::render(RenderWindow& window)
+void Invader::render(RenderList& window)
 {
     Enemy::render(window);
 }
 
-void Invader::update(float deltaTime)
+void Invader::think()
 {
-    Enemy::update(deltaTime);
+    if (Game::freeze.isEffectActive() || !AIScheduler::shouldThink(clock)) return;
 
-    if (Game::freeze.isEffectActive()) return;
-
-    changePosition.updateEffectDuration(deltaTime);
-    shoot.updateEffectDuration(deltaTime);
+    const auto& blackboard = AIScheduler::getBlackboard();
 
-    Entity* player = Game::getEntities().back();
-    Vector2f playerPosition = player->position;
+    if (blackboard.hasPlayer) directionToPlayer = physics::normalize(blackboard.playerPosition - position);
 
-    Vector2f directionToPlayer = physics::normalize(playerPosition - position);
-    angle = atan2(directionToPlayer.y, directionToPlayer.x) * 180 / physics::getPI();
+    aimAngle = atan2(directionToPlayer.y, directionToPlayer.x) * 180 / physics::getPI();
 
-    float angleOffset = (rand() % 40 - 10) * physics::getPI() / 180.0f;
+    float angleOffset = floor(clock.getRandom(-10.0f, 30.0f)) * physics::getPI() / 180.0f;
     float cosAngle = cos(angleOffset);
     float sinAngle = sin(angleOffset);
-    Vector2f slightlyOffDirection = Vector2f(directionToPlayer.x * cosAngle - directionToPlayer.y * sinAngle,
+    slightlyOffDirection = Vector2f(directionToPlayer.x * cosAngle - directionToPlayer.y * sinAngle,
         directionToPlayer.x * sinAngle + directionToPlayer.y * cosAngle);
 
-    if (!changePosition.isEffectActive()) {
-        newPosition = physics::getRandomPosition(radius);
-        target = newPosition - position;
-        changePosition.startEffect(5.0f);
+    bulletAngle = atan2(slightlyOffDirection.y, slightlyOffDirection.x) * 180 / physics::getPI();
+
+    // Only read the clock here, scheduling timers from a worker isn't safe
+    if (Timers::now(GameClock::WORLD) >= waypointDue) {
+        newPosition = Vector2f(clock.getRandom(radius, WindowBox::getVideoMode().width - radius), clock.getRandom(radius, WindowBox::getVideoMode().height - radius));
+        waypointDue = Timers::now(GameClock::WORLD) + waypointInterval;
     }
+}
+
+void Invader::update(float deltaTime)
+{
+    Enemy::update(deltaTime);
+
+    if (Game::freeze.isEffectActive()) return;
 
-    float bulletAngle = atan2(slightlyOffDirection.y, slightlyOffDirection.x) * 180 / physics::getPI();
+    angle = AIScheduler::turnTowards(angle, aimAngle, deltaTime);
+    target = newPosition - position;
 
-    if (physics::distance(newPosition, position) <= 100.0f) {
-        if (!shoot.isEffectActive()) {
-            shoot.startEffect(1.0f);
+    arrived = physics::distance(newPosition, position) <= 100.0f;
 
-            Game::addEntity(new EnemyBullet(position, slightlyOffDirection, bulletAngle, Sprites::ENEMY_BULLET));
-            SoundData::play(Sounds::ALIEN_SHOOT1);
-        }
+    if (arrived) {
+        arrival.raise();
+        heading = Vector2f();
         return;
     }
-    position += physics::normalize(target) * deltaTime * speed;
+    // The flock bends the way to the waypoint but never stops the invader
+    heading = physics::normalize(physics::normalize(target) + flockSteering);
+    position += heading * deltaTime * speed;
 
     setSpriteFullCycle(deltaTime);
 }
 
+// Only shoots while parked at its waypoint
+BehaviourTask Invader::attack()
+{
+    size_t volley = 0;
+
+    for (;;) {
+        while (!arrived) co_await behaviour::until(arrival);
+
+        Patterns::emit(Faction::ENEMY, Patterns::get("invaderShot"), position, bulletAngle, volley++);
+        SoundData::play(Sounds::ALIEN_SHOOT1);
+
+        co_await behaviour::seconds(1.0f);
+    }
+}
+
 void Invader::collisionDetection() {}
 
+void Invader::flock(const Vector2f& steering)
+{
+    flockSteering = steering;
+}
+
+const Vector2f& Invader::getHeading() const
+{
+    return heading;
+}
+
 void Invader::destroy()
 {
+    // Lets a parked attack see its owner is gone and free its frame
+    arrival.raise();
+
     Game::replaceEntity(this, new Explosion(position, size));
 
     for (size_t i = 0; i < 3; i++)
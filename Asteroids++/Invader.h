@@ -3,6 +3,8 @@
 #define INVADER_H
 
 #include "Enemy.h"
+#include "AIScheduler.h"
+#include "Behaviours.h"
 #include "Entity.h"
 
 using namespace sf;
@@ -13,16 +15,30 @@ class Invader : public Enemy
 public:
 	Invader();
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
+	void think() override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void destroy() override;
 
+	void flock(const Vector2f& steering);
+	const Vector2f& getHeading() const;
+
 private:
+	BehaviourTask attack();
+
 	Vector2f newPosition;
 	Vector2f target;
-	Effect changePosition;
-	Effect shoot;
+	double waypointDue;
+	Vector2f directionToPlayer;
+	Vector2f slightlyOffDirection;
+	float aimAngle;
+	float bulletAngle;
+	AIClock clock;
+	Vector2f flockSteering;
+	Vector2f heading;
+	bool arrived;
+	BehaviourSignal arrival;
 };
 
 #endif
\ No newline at end of file
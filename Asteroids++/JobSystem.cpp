@@ -0,0 +1,99 @@
+#include "JobSystem.h"
+
+const size_t minimumChunkSize = 16;
+
+vector<thread> JobSystem::workers;
+mutex JobSystem::jobMutex;
+condition_variable JobSystem::jobReady;
+condition_variable JobSystem::jobDone;
+const Job* JobSystem::currentJob = nullptr;
+size_t JobSystem::jobCount{ 0 };
+size_t JobSystem::generation{ 0 };
+size_t JobSystem::pending{ 0 };
+bool JobSystem::running{ false };
+
+void JobSystem::init(const size_t& workerCount)
+{
+	shutdown();
+
+	const auto count = workerCount > 0 ? workerCount : max(thread::hardware_concurrency(), 1u) - 1;
+
+	running = true;
+
+	for (size_t i = 0; i < count; i++) workers.emplace_back(workerLoop, i + 1);
+}
+
+void JobSystem::shutdown()
+{
+	{
+		lock_guard<mutex> lock(jobMutex);
+		running = false;
+	}
+	jobReady.notify_all();
+
+	for (auto& worker : workers) worker.join();
+
+	workers.clear();
+}
+
+const size_t JobSystem::getChunkCount()
+{
+	return workers.size() + 1;
+}
+
+void JobSystem::parallelFor(const size_t& count, const Job& job)
+{
+	if (count == 0) return;
+
+	// Not worth waking the workers up for a handful of items
+	if (workers.empty() || count < minimumChunkSize * getChunkCount()) {
+		job(0, count, 0);
+		return;
+	}
+
+	{
+		lock_guard<mutex> lock(jobMutex);
+		currentJob = &job;
+		jobCount = count;
+		pending = workers.size();
+		generation++;
+	}
+	jobReady.notify_all();
+
+	runChunk(job, count, 0);
+
+	unique_lock<mutex> lock(jobMutex);
+	jobDone.wait(lock, []() { return pending == 0; });
+	currentJob = nullptr;
+}
+
+void JobSystem::workerLoop(const size_t& chunk)
+{
+	size_t seen = 0;
+
+	while (true) {
+		unique_lock<mutex> lock(jobMutex);
+		jobReady.wait(lock, [&]() { return !running || generation != seen; });
+
+		if (!running) return;
+
+		seen = generation;
+		const auto job = currentJob;
+		const auto count = jobCount;
+
+		lock.unlock();
+		runChunk(*job, count, chunk);
+		lock.lock();
+
+		if (--pending == 0) jobDone.notify_one();
+	}
+}
+
+void JobSystem::runChunk(const Job& job, const size_t& count, const size_t& chunk)
+{
+	const auto chunks = getChunkCount();
+	const auto begin = count * chunk / chunks;
+	const auto end = count * (chunk + 1) / chunks;
+
+	if (begin < end) job(begin, end, chunk);
+}
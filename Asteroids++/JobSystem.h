@@ -0,0 +1,40 @@
+#pragma once
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+using namespace std;
+
+using Job = function<void(const size_t& begin, const size_t& end, const size_t& chunk)>;
+
+class JobSystem {
+public:
+	static void init(const size_t& workerCount);
+	static void shutdown();
+
+	static const size_t getChunkCount();
+
+	// Splits [0, count) into getChunkCount() contiguous ranges, chunk 0 runs on the calling thread
+	static void parallelFor(const size_t& count, const Job& job);
+private:
+	static void workerLoop(const size_t& chunk);
+	static void runChunk(const Job& job, const size_t& count, const size_t& chunk);
+
+	static vector<thread> workers;
+	static mutex jobMutex;
+	static condition_variable jobReady;
+	static condition_variable jobDone;
+
+	static const Job* currentJob;
+	static size_t jobCount;
+	static size_t generation;
+	static size_t pending;
+	static bool running;
+};
+
+#endif
@@ -0,0 +1,208 @@
+#include "Kinematics.h"
+#include "Enemy.h"
+#include "WindowBox.h"
+#include "JobSystem.h"
+#include "Gravity.h"
+#include <cmath>
+
+const size_t Kinematics::none = static_cast<size_t>(-1);
+
+const float maxPulledSpeed = 600.0f;
+
+vector<float> Kinematics::positionX;
+vector<float> Kinematics::positionY;
+vector<float> Kinematics::directionX;
+vector<float> Kinematics::directionY;
+vector<float> Kinematics::speed;
+vector<float> Kinematics::angle;
+vector<float> Kinematics::spin;
+vector<float> Kinematics::radius;
+vector<EdgeMode> Kinematics::edges;
+vector<Enemy*> Kinematics::owners;
+vector<size_t> Kinematics::freeBodies;
+
+size_t Kinematics::add(Enemy* owner, const EdgeMode& edge, const float& bodySpin)
+{
+	size_t body;
+
+	if (!freeBodies.empty()) {
+		body = freeBodies.back();
+		freeBodies.pop_back();
+	}
+	else {
+		body = owners.size();
+
+		positionX.push_back(0.0f);
+		positionY.push_back(0.0f);
+		directionX.push_back(0.0f);
+		directionY.push_back(0.0f);
+		speed.push_back(0.0f);
+		angle.push_back(0.0f);
+		spin.push_back(0.0f);
+		radius.push_back(0.0f);
+		edges.push_back(EdgeMode::NONE);
+		owners.push_back(nullptr);
+	}
+
+	positionX[body] = owner->position.x;
+	positionY[body] = owner->position.y;
+	directionX[body] = owner->direction.x;
+	directionY[body] = owner->direction.y;
+	speed[body] = owner->speed;
+	angle[body] = owner->angle;
+	spin[body] = bodySpin;
+	radius[body] = owner->radius;
+	edges[body] = edge;
+	owners[body] = owner;
+
+	return body;
+}
+
+void Kinematics::remove(const size_t& body)
+{
+	if (body == none || !owners[body]) return;
+
+	owners[body]->body = none;
+	owners[body] = nullptr;
+
+	// Free bodies stay in the arrays, they just stop moving
+	speed[body] = 0.0f;
+	spin[body] = 0.0f;
+	edges[body] = EdgeMode::NONE;
+
+	freeBodies.push_back(body);
+}
+
+void Kinematics::setPosition(const size_t& body, const Vector2f& position)
+{
+	positionX[body] = position.x;
+	positionY[body] = position.y;
+}
+
+void Kinematics::setDirection(const size_t& body, const Vector2f& direction)
+{
+	directionX[body] = direction.x;
+	directionY[body] = direction.y;
+}
+
+void Kinematics::setVelocity(const size_t& body, const Vector2f& velocity)
+{
+	const auto newSpeed = sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
+
+	if (newSpeed > 0.0f) {
+		directionX[body] = velocity.x / newSpeed;
+		directionY[body] = velocity.y / newSpeed;
+	}
+
+	speed[body] = newSpeed;
+}
+
+void Kinematics::setEdgeMode(const size_t& body, const EdgeMode& edge)
+{
+	edges[body] = edge;
+}
+
+void Kinematics::applyImpulse(const size_t& body, const Vector2f& impulse)
+{
+	const auto velocityX = directionX[body] * speed[body] + impulse.x;
+	const auto velocityY = directionY[body] * speed[body] + impulse.y;
+	const auto newSpeed = sqrt(velocityX * velocityX + velocityY * velocityY);
+
+	if (newSpeed <= 0.0f) return;
+
+	directionX[body] = velocityX / newSpeed;
+	directionY[body] = velocityY / newSpeed;
+	speed[body] = min(newSpeed, maxPulledSpeed);
+}
+
+void Kinematics::integrate(const float& deltaTime)
+{
+	if (Game::freeze.isEffectActive()) return;
+
+	const auto width = float(WindowBox::getVideoMode().width);
+	const auto height = float(WindowBox::getVideoMode().height);
+
+	JobSystem::parallelFor(owners.size(), [&](const size_t& begin, const size_t& end, const size_t&) {
+		integrateRange(begin, end, deltaTime);
+		bounceRange(begin, end, width, height);
+		wrapRange(begin, end, width, height);
+	});
+}
+
+void Kinematics::publish()
+{
+	for (size_t body = 0; body < owners.size(); body++) {
+		const auto owner = owners[body];
+
+		if (!owner) continue;
+
+		// Replaced enemies are only switched off, not deleted
+		if (!owner->isActive()) {
+			remove(body);
+			continue;
+		}
+
+		owner->position = Vector2f(positionX[body], positionY[body]);
+		owner->direction = Vector2f(directionX[body], directionY[body]);
+		owner->speed = speed[body];
+		owner->angle = angle[body];
+	}
+}
+
+const size_t Kinematics::getCount()
+{
+	return owners.size() - freeBodies.size();
+}
+
+void Kinematics::integrateRange(const size_t& begin, const size_t& end, const float& deltaTime)
+{
+	if (Gravity::hasAttractors()) pullRange(begin, end, deltaTime);
+
+	for (size_t i = begin; i < end; i++) {
+		positionX[i] += directionX[i] * speed[i] * deltaTime;
+		positionY[i] += directionY[i] * speed[i] * deltaTime;
+		angle[i] += spin[i] * deltaTime;
+	}
+}
+
+// Gravity turns the heading and changes the speed, capped so a close pass can't fling a body off screen in one frame
+void Kinematics::pullRange(const size_t& begin, const size_t& end, const float& deltaTime)
+{
+	for (size_t i = begin; i < end; i++) {
+		if (!owners[i]) continue;
+
+		const auto acceleration = Gravity::getAcceleration(Vector2f(positionX[i], positionY[i]));
+		const auto velocityX = directionX[i] * speed[i] + acceleration.x * deltaTime;
+		const auto velocityY = directionY[i] * speed[i] + acceleration.y * deltaTime;
+		const auto newSpeed = sqrt(velocityX * velocityX + velocityY * velocityY);
+
+		if (newSpeed <= 0.0f) continue;
+
+		directionX[i] = velocityX / newSpeed;
+		directionY[i] = velocityY / newSpeed;
+		speed[i] = min(newSpeed, maxPulledSpeed);
+	}
+}
+
+void Kinematics::bounceRange(const size_t& begin, const size_t& end, const float& width, const float& height)
+{
+	// Branchless selects so the loop vectorizes, bodies with other edge modes keep their direction
+	for (size_t i = begin; i < end; i++) {
+		const bool bounce = edges[i] == EdgeMode::BOUNCE;
+		const auto x = abs(directionX[i]);
+		const auto y = abs(directionY[i]);
+
+		directionX[i] = bounce && positionX[i] < radius[i] ? x : bounce && positionX[i] > width - radius[i] ? -x : directionX[i];
+		directionY[i] = bounce && positionY[i] < radius[i] ? y : bounce && positionY[i] > height - radius[i] ? -y : directionY[i];
+	}
+}
+
+void Kinematics::wrapRange(const size_t& begin, const size_t& end, const float& width, const float& height)
+{
+	for (size_t i = begin; i < end; i++) {
+		const bool wrap = edges[i] == EdgeMode::WRAP;
+
+		positionX[i] = wrap && positionX[i] < -radius[i] ? width + radius[i] : wrap && positionX[i] > width + radius[i] ? -radius[i] : positionX[i];
+		positionY[i] = wrap && positionY[i] < -radius[i] ? height + radius[i] : wrap && positionY[i] > height + radius[i] ? -radius[i] : positionY[i];
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#ifndef KINEMATICS_H
+#define KINEMATICS_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+
+using namespace sf;
+using namespace std;
+
+class Enemy;
+
+enum class EdgeMode : uint8_t {
+	NONE,
+	BOUNCE,
+	WRAP
+};
+
+// Movement state of plain drifting enemies, kept in flat arrays so a whole frame integrates in one pass
+class Kinematics {
+public:
+	static const size_t none;
+
+	static size_t add(Enemy* owner, const EdgeMode& edge, const float& spin);
+	static void remove(const size_t& body);
+
+	static void setPosition(const size_t& body, const Vector2f& position);
+	static void setDirection(const size_t& body, const Vector2f& direction);
+	static void setVelocity(const size_t& body, const Vector2f& velocity);
+	static void setEdgeMode(const size_t& body, const EdgeMode& edge);
+	static void applyImpulse(const size_t& body, const Vector2f& impulse);
+
+	static void integrate(const float& deltaTime);
+	static void publish();
+
+	static const size_t getCount();
+private:
+	static void integrateRange(const size_t& begin, const size_t& end, const float& deltaTime);
+	static void pullRange(const size_t& begin, const size_t& end, const float& deltaTime);
+	static void bounceRange(const size_t& begin, const size_t& end, const float& width, const float& height);
+	static void wrapRange(const size_t& begin, const size_t& end, const float& width, const float& height);
+
+	static vector<float> positionX;
+	static vector<float> positionY;
+	static vector<float> directionX;
+	static vector<float> directionY;
+	static vector<float> speed;
+	static vector<float> angle;
+	static vector<float> spin;
+	static vector<float> radius;
+	static vector<EdgeMode> edges;
+
+	static vector<Enemy*> owners;
+	static vector<size_t> freeBodies;
+};
+
+#endif
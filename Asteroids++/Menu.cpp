@@ -83,7 +83,7 @@ const string Menu::getSelectedOption() const {
 	return options[selectedOption].getText().getString();
 }
 
-void Menu::draw(RenderWindow& window) {
+void Menu::draw(RenderList& window) {
 	for (auto& option : navigation) window.draw(option.getText());
 
 	window.draw(menuText.getText());
@@ -91,24 +91,18 @@ void Menu::draw(RenderWindow& window) {
 	for (auto& option : options) window.draw(option.getText());
 }
 
-void Menu::navigator(Event& event)
+void Menu::navigator(const InputSnapshot& input)
 {
-	if (WindowBox::isKeyPressed) return;
-
-	if (Keyboard::isKeyPressed(Keyboard::Up)) {
+	if (input.isPressed(Action::UP)) {
 		moveUp();
 		SoundData::play(Sounds::PING);
-
-		WindowBox::isKeyPressed = true;
 	}
-	if (Keyboard::isKeyPressed(Keyboard::Down)) {
+	if (input.isPressed(Action::DOWN)) {
 		moveDown();
 		SoundData::play(Sounds::PING);
-
-		WindowBox::isKeyPressed = true;
 	}
 
-	if (Keyboard::isKeyPressed(Keyboard::Enter)) {
+	if (input.isPressed(Action::CONFIRM)) {
 		switch (selectedOption) {
 		case 0:
 			WindowBox::begin();
@@ -120,12 +114,10 @@ void Menu::navigator(Event& event)
 			WindowBox::close();
 			break;
 		}
-
-		WindowBox::isKeyPressed = true;
 	}
 }
 
-void Menu::run(const float& deltaTime, RenderWindow& window) {
+void Menu::run(const float& deltaTime, RenderList& window) {
 	Page::run(deltaTime, window);
 
 	for (size_t i = 0; i < options.size(); ++i) {
@@ -13,8 +13,8 @@ class Menu : public Page
 public:
 	Menu();
 
-	void navigator(Event& event) override;
-	void run(const float& deltaTime, RenderWindow& window) override;
+	void navigator(const InputSnapshot& input) override;
+	void run(const float& deltaTime, RenderList& window) override;
 
 	static vector<TextField> navigation;
 private:
@@ -26,7 +26,7 @@ private:
 	const int getSelectedOptionIndex() const;
 	const string getSelectedOption() const;
 	
-	void draw(RenderWindow& window);
+	void draw(RenderList& window);
 
 	TextField menuText;
 
@@ -17,7 +17,7 @@ void MenuLoader::init()
 	loadParticles();
 }
 
-void MenuLoader::run(const float& deltaTime, RenderWindow& window)
+void MenuLoader::run(const float& deltaTime, RenderList& window)
 {
 	Page::run(deltaTime, window);
 
@@ -76,7 +76,7 @@ void MenuLoader::run(const float& deltaTime, RenderWindow& window)
 
 		circle.setFillColor(c);
 
-		FloatRect bounds(-circle.getRadius(), -circle.getRadius(), window.getSize().x + circle.getRadius(), window.getSize().y + circle.getRadius());
+		FloatRect bounds(-circle.getRadius(), -circle.getRadius(), WindowBox::getVideoMode().width + circle.getRadius(), WindowBox::getVideoMode().height + circle.getRadius());
 
 		if (!bounds.contains(circle.getPosition())) {
 			if (circle.getPosition().x < bounds.left)
@@ -93,7 +93,11 @@ void MenuLoader::run(const float& deltaTime, RenderWindow& window)
 	}
 }
 
-void MenuLoader::navigator(Event& e) {}
+// The intro can be skipped straight to the menu
+void MenuLoader::navigator(const InputSnapshot& input)
+{
+	if (input.isPressed(Action::CONFIRM)) Game::setGameState(MENU);
+}
 
 void MenuLoader::loadParticles() {
 	for (size_t i = 0; i < 50; i++) {
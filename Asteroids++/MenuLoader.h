@@ -13,8 +13,8 @@ class MenuLoader : public Page
 public:
 	MenuLoader();
 
-	void run(const float& deltaTime, RenderWindow& window) override;
-	void navigator(Event& e) override;
+	void run(const float& deltaTime, RenderList& window) override;
+	void navigator(const InputSnapshot& input) override;
 
 private:
 	void init() override;
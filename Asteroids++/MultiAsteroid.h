@@ -13,7 +13,7 @@ class MultiAsteroid : public Enemy
 public:
 	MultiAsteroid();
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void destroy() override;
@@ -0,0 +1,177 @@
+#include "Narrowphase.h"
+#include "Entity.h"
+#include <bit>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define NARROWPHASE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX
+#else
+#include <cpuid.h>
+#define TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+const vector<string> kernelNames = { "scalar", "sse2", "avx" };
+
+const NarrowphaseKernel Narrowphase::kernel = Narrowphase::detectKernel();
+
+void CircleBatch::add(Entity* entity)
+{
+	x.push_back(entity->position.x);
+	y.push_back(entity->position.y);
+	radius.push_back(entity->radius);
+	entities.push_back(entity);
+}
+
+void CircleBatch::clear()
+{
+	x.clear();
+	y.clear();
+	radius.clear();
+	entities.clear();
+}
+
+const size_t CircleBatch::size() const
+{
+	return x.size();
+}
+
+void Narrowphase::query(const Vector2f& position, const float& radius, const CircleBatch& batch, vector<size_t>& hits)
+{
+	size_t tail = 0;
+
+	switch (kernel)
+	{
+	case NarrowphaseKernel::AVX:
+		tail = queryAvx(position.x, position.y, radius, batch, hits);
+		break;
+	case NarrowphaseKernel::SSE2:
+		tail = querySse2(position.x, position.y, radius, batch, hits);
+		break;
+	default:
+		break;
+	}
+
+	queryScalar(position.x, position.y, radius, batch, tail, hits);
+}
+
+void Narrowphase::query(const CircleBatch& queries, const CircleBatch& batch, vector<pair<size_t, size_t>>& hits)
+{
+	vector<size_t> found;
+
+	for (size_t i = 0; i < queries.size(); i++) {
+		found.clear();
+		query(Vector2f(queries.x[i], queries.y[i]), queries.radius[i], batch, found);
+
+		for (const auto& hit : found) hits.push_back({ i, hit });
+	}
+}
+
+const NarrowphaseKernel Narrowphase::getKernel()
+{
+	return kernel;
+}
+
+const string Narrowphase::getKernelName()
+{
+	return kernelNames[static_cast<size_t>(kernel)];
+}
+
+const NarrowphaseKernel Narrowphase::detectKernel()
+{
+#ifdef NARROWPHASE_X86
+	int info[4]{};
+
+#ifdef _MSC_VER
+	__cpuid(info, 1);
+#else
+	__cpuid(1, info[0], info[1], info[2], info[3]);
+#endif
+
+	const bool sse2 = info[3] & (1 << 26);
+	const bool osxsave = info[2] & (1 << 27);
+	const bool avx = info[2] & (1 << 28);
+
+	// AVX also needs the OS to save the upper halves of the registers
+	if (avx && osxsave) {
+#ifdef _MSC_VER
+		const auto xcr0 = _xgetbv(0);
+#else
+		unsigned int low, high;
+		__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		const unsigned long long xcr0 = low;
+#endif
+		if ((xcr0 & 6) == 6) return NarrowphaseKernel::AVX;
+	}
+
+	if (sse2) return NarrowphaseKernel::SSE2;
+#endif
+
+	return NarrowphaseKernel::SCALAR;
+}
+
+size_t Narrowphase::queryScalar(const float& x, const float& y, const float& radius, const CircleBatch& batch, const size_t& begin, vector<size_t>& hits)
+{
+	for (size_t i = begin; i < batch.size(); i++) {
+		const auto dx = batch.x[i] - x;
+		const auto dy = batch.y[i] - y;
+		const auto reach = batch.radius[i] + radius;
+
+		if (dx * dx + dy * dy <= reach * reach) hits.push_back(i);
+	}
+
+	return batch.size();
+}
+
+size_t Narrowphase::querySse2(const float& x, const float& y, const float& radius, const CircleBatch& batch, vector<size_t>& hits)
+{
+	size_t i = 0;
+
+#ifdef NARROWPHASE_X86
+	const auto queryX = _mm_set1_ps(x);
+	const auto queryY = _mm_set1_ps(y);
+	const auto queryRadius = _mm_set1_ps(radius);
+
+	for (; i + 4 <= batch.size(); i += 4) {
+		const auto dx = _mm_sub_ps(_mm_loadu_ps(&batch.x[i]), queryX);
+		const auto dy = _mm_sub_ps(_mm_loadu_ps(&batch.y[i]), queryY);
+		const auto reach = _mm_add_ps(_mm_loadu_ps(&batch.radius[i]), queryRadius);
+		const auto distanceSquared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+		auto mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmple_ps(distanceSquared, _mm_mul_ps(reach, reach))));
+
+		for (; mask; mask &= mask - 1) hits.push_back(i + countr_zero(mask));
+	}
+#endif
+
+	return i;
+}
+
+TARGET_AVX size_t Narrowphase::queryAvx(const float& x, const float& y, const float& radius, const CircleBatch& batch, vector<size_t>& hits)
+{
+	size_t i = 0;
+
+#ifdef NARROWPHASE_X86
+	const auto queryX = _mm256_set1_ps(x);
+	const auto queryY = _mm256_set1_ps(y);
+	const auto queryRadius = _mm256_set1_ps(radius);
+
+	for (; i + 8 <= batch.size(); i += 8) {
+		const auto dx = _mm256_sub_ps(_mm256_loadu_ps(&batch.x[i]), queryX);
+		const auto dy = _mm256_sub_ps(_mm256_loadu_ps(&batch.y[i]), queryY);
+		const auto reach = _mm256_add_ps(_mm256_loadu_ps(&batch.radius[i]), queryRadius);
+		const auto distanceSquared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+		auto mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(distanceSquared, _mm256_mul_ps(reach, reach), _CMP_LE_OQ)));
+
+		for (; mask; mask &= mask - 1) hits.push_back(i + countr_zero(mask));
+	}
+
+	_mm256_zeroupper();
+#endif
+
+	return i;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef NARROWPHASE_H
+#define NARROWPHASE_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <string>
+
+using namespace sf;
+using namespace std;
+
+class Entity;
+
+// Packed circles tested against in one pass, indices of hits refer back into entities when they are tracked
+struct CircleBatch {
+	vector<float> x;
+	vector<float> y;
+	vector<float> radius;
+	vector<Entity*> entities;
+
+	void add(Entity* entity);
+	void clear();
+	const size_t size() const;
+};
+
+enum class NarrowphaseKernel {
+	SCALAR,
+	SSE2,
+	AVX
+};
+
+class Narrowphase {
+public:
+	static void query(const Vector2f& position, const float& radius, const CircleBatch& batch, vector<size_t>& hits);
+	static void query(const CircleBatch& queries, const CircleBatch& batch, vector<pair<size_t, size_t>>& hits);
+
+	static const NarrowphaseKernel getKernel();
+	static const string getKernelName();
+private:
+	static const NarrowphaseKernel detectKernel();
+
+	static size_t queryScalar(const float& x, const float& y, const float& radius, const CircleBatch& batch, const size_t& begin, vector<size_t>& hits);
+	static size_t querySse2(const float& x, const float& y, const float& radius, const CircleBatch& batch, vector<size_t>& hits);
+	static size_t queryAvx(const float& x, const float& y, const float& radius, const CircleBatch& batch, vector<size_t>& hits);
+
+	static const NarrowphaseKernel kernel;
+};
+
+#endif
@@ -3,22 +3,33 @@
 
 Page::Page(string backgroundname) : backgroundname(backgroundname)
 {
-	init();
 }
 
 Page::Page() {}
 
 void Page::init()
 {
-	if (!texture.loadFromFile("./assets/" + backgroundname + ".png"))
-		cout << "Error: Cannot load background!" << endl;
+	texture = ResourceCache::getTexture(getBackgroundPath(backgroundname));
 
-	background.setTexture(texture);
+	background.setTexture(*texture);
 }
 
-void Page::run(const float& deltaTime, RenderWindow& window)
+void Page::run(const float&, RenderList& window)
 {
+	window.setLayer(RenderLayer::BACKGROUND);
+	window.keepAlive(texture);
 	window.draw(background);
+	window.setLayer(RenderLayer::ENTITIES);
+}
+
+void Page::preload(const string& backgroundname)
+{
+	ResourceCache::preloadTexture(getBackgroundPath(backgroundname));
+}
+
+const string Page::getBackgroundPath(const string& backgroundname)
+{
+	return "./assets/" + backgroundname + ".png";
 }
 
 Color Page::getBackgroundColor()
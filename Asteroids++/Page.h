@@ -4,6 +4,9 @@
 
 #include "TextField.h"
 #include "Player.h"
+#include "ResourceCache.h"
+#include "Input.h"
+#include "RenderList.h"
 
 using namespace sf;
 using namespace std;
@@ -13,19 +16,24 @@ class Page
 public:
 	Page(string backgroundname);
 	Page();
+	virtual ~Page() = default;
 
 	virtual void init();
-	virtual void run(const float& deltaTime, RenderWindow& window);
-	virtual void navigator(Event& e) = 0;
+	virtual void run(const float& deltaTime, RenderList& window);
+	virtual void navigator(const InputSnapshot& input) = 0;
+
+	static void preload(const string& backgroundname);
 
 	Color getBackgroundColor();
 	void setBackgroundColor(const Color& newColor);
 
 private:
+	static const string getBackgroundPath(const string& backgroundname);
+
 	string backgroundname;
 
 	Sprite background;
-	Texture texture;
+	shared_ptr<Texture> texture;
 };
 
 #endif
\ No newline at end of file
@@ -23,7 +23,7 @@ Particle::Particle(Vector2f position, float angle, Sprites sprites, Color color,
 	spriteInfo.sprite.setColor(color);
 }
 
-void Particle::render(RenderWindow& window)
+void Particle::render(RenderList& window)
 {
 	window.draw(spriteInfo.sprite, Transform().translate(position).rotate(angle));
 }
@@ -14,7 +14,7 @@ public:
     Particle(Vector2f position, float angle, Sprites sprites, Color color, double lifeTime);
     Particle(Vector2f position, float angle, Sprites sprites, Color color, double lifeTime, float size);
 
-    void render(RenderWindow& window) override;
+    void render(RenderList& window) override;
     void update(float deltaTime) override;
     const EntityType getEntityType() override;
     void collisionDetection() override;
@@ -0,0 +1,118 @@
+#include "Patterns.h"
+#include "Physics.h"
+#include "rapidjson/document.h"
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <cmath>
+
+using namespace rapidjson;
+
+const auto patternsFile = "./assets/patterns.json";
+
+unordered_map<string, BulletPattern> Patterns::patterns;
+
+vector<Vector2f> Patterns::positions;
+vector<Vector2f> Patterns::directions;
+vector<float> Patterns::angles;
+
+void Patterns::loadAllPatterns()
+{
+	ifstream jsonFile(patternsFile);
+	if (!jsonFile.is_open()) {
+		cerr << "Unable to open file " << patternsFile << endl;
+		return;
+	}
+
+	stringstream jsonString;
+	jsonString << jsonFile.rdbuf();
+
+	Document document;
+	document.Parse(jsonString.str().c_str());
+
+	if (!document.IsObject()) {
+		cerr << "Failed to parse JSON from file " << patternsFile << endl;
+		return;
+	}
+
+	const unordered_map<string, PatternShape> shapes{
+		{ "ring", PatternShape::RING },
+		{ "fan", PatternShape::FAN },
+		{ "burst", PatternShape::BURST }
+	};
+
+	for (auto member = document.MemberBegin(); member != document.MemberEnd(); ++member) {
+		const auto& object = member->value;
+		if (!object.IsObject()) continue;
+
+		BulletPattern pattern;
+
+		if (object.HasMember("shape") && object["shape"].IsString()) {
+			const auto shape = shapes.find(object["shape"].GetString());
+			if (shape != shapes.end()) pattern.shape = shape->second;
+		}
+		if (object.HasMember("count") && object["count"].IsNumber()) {
+			pattern.count = max(int(lround(object["count"].GetDouble())), 1);
+		}
+		if (object.HasMember("spread") && object["spread"].IsNumber()) {
+			pattern.spread = object["spread"].GetFloat();
+		}
+		if (object.HasMember("rotation") && object["rotation"].IsNumber()) {
+			pattern.rotation = object["rotation"].GetFloat();
+		}
+		if (object.HasMember("jitter") && object["jitter"].IsNumber()) {
+			pattern.jitter = object["jitter"].GetFloat();
+		}
+
+		patterns[member->name.GetString()] = pattern;
+	}
+
+	// The biggest volley decides the scratch size, so emitting never allocates
+	size_t largest = 0;
+	for (const auto& [name, pattern] : patterns) largest = max(largest, size_t(pattern.count));
+
+	positions.reserve(largest);
+	directions.reserve(largest);
+	angles.reserve(largest);
+}
+
+const BulletPattern& Patterns::get(const string& name)
+{
+	static const BulletPattern single;
+
+	const auto pattern = patterns.find(name);
+	return pattern != patterns.end() ? pattern->second : single;
+}
+
+void Patterns::emit(const Faction& faction, const BulletPattern& pattern, const Vector2f& position, const float& angle, const size_t& volley)
+{
+	positions.clear();
+	directions.clear();
+	angles.clear();
+
+	const auto base = angle + pattern.rotation * volley;
+	const auto count = pattern.count;
+
+	for (int i = 0; i < count; i++) {
+		auto bulletAngle = base;
+
+		switch (pattern.shape) {
+		case PatternShape::RING:
+			bulletAngle += pattern.spread * i / count;
+			break;
+		case PatternShape::FAN:
+			if (count > 1) bulletAngle += pattern.spread * i / (count - 1) - pattern.spread / 2;
+			break;
+		case PatternShape::BURST:
+			break;
+		}
+
+		const auto radians = bulletAngle * physics::getPI() / 180.0f;
+
+		positions.push_back(pattern.jitter > 0.0f ? position + physics::getRandomDirection() * pattern.jitter : position);
+		directions.push_back(Vector2f(cos(radians), sin(radians)));
+		angles.push_back(bulletAngle);
+	}
+
+	Projectiles::fire(faction, positions, directions, angles);
+}
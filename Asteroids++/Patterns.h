@@ -0,0 +1,45 @@
+#pragma once
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "Projectiles.h"
+
+using namespace sf;
+using namespace std;
+
+enum class PatternShape : uint8_t {
+	RING,
+	FAN,
+	BURST
+};
+
+// Angles are in degrees, rotation turns the whole pattern a bit more on every volley to make spirals
+struct BulletPattern {
+	PatternShape shape = PatternShape::FAN;
+	int count = 1;
+	float spread = 0.0f;
+	float rotation = 0.0f;
+	float jitter = 0.0f;
+};
+
+// Volleys described in assets/patterns.json, written into the projectile pools in one go
+class Patterns {
+public:
+	static void loadAllPatterns();
+
+	static const BulletPattern& get(const string& name);
+	static void emit(const Faction& faction, const BulletPattern& pattern, const Vector2f& position, const float& angle, const size_t& volley);
+private:
+	static unordered_map<string, BulletPattern> patterns;
+
+	static vector<Vector2f> positions;
+	static vector<Vector2f> directions;
+	static vector<float> angles;
+};
+
+#endif
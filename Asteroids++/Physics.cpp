@@ -5,10 +5,33 @@ constexpr float M_PI = 3.14159265358979323846f;
 
 bool physics::intersects(const Vector2f& circlePosition1, const float &radius1 ,const Vector2f& circlePosition2, const float& radius2)
 {
-	float circleRadiusSum = radius1 + radius2;
-	float distanceSquared = distance(circlePosition1, circlePosition2);
+	const auto offset = circlePosition2 - circlePosition1;
+	const auto circleRadiusSum = radius1 + radius2;
 
-	return distanceSquared <= circleRadiusSum;
+	return offset.x * offset.x + offset.y * offset.y <= circleRadiusSum * circleRadiusSum;
+}
+
+// Fraction of the way from start to end where a moving circle first touches a still one, or -1 when it never does
+float physics::sweep(const Vector2f& start, const Vector2f& end, const float& radius1, const Vector2f& circlePosition, const float& radius2)
+{
+	const auto path = end - start;
+	const auto offset = start - circlePosition;
+	const auto circleRadiusSum = radius1 + radius2;
+
+	const auto a = path.x * path.x + path.y * path.y;
+	const auto c = offset.x * offset.x + offset.y * offset.y - circleRadiusSum * circleRadiusSum;
+
+	if (c <= 0) return 0.0f;
+	if (a == 0) return -1.0f;
+
+	// Closest point of the segment to the circle decides whether they touch at all
+	const auto b = offset.x * path.x + offset.y * path.y;
+	const auto closest = min(max(-b / a, 0.0f), 1.0f);
+	const auto nearest = offset + path * closest;
+
+	if (nearest.x * nearest.x + nearest.y * nearest.y > circleRadiusSum * circleRadiusSum) return -1.0f;
+
+	return max((-b - sqrt(max(b * b - a * c, 0.0f))) / a, 0.0f);
 }
 
 // Funkcja do obliczania dugoci wektora
@@ -71,32 +94,7 @@ float physics::dotProduct(const Vector2f& v1, const Vector2f& v2) {
 
 float physics::distance(const Vector2f& p1, const Vector2f& p2)
 {
-	return static_cast<float>(sqrt(pow(p2.x - p1.x, 2) + pow(p2.y - p1.y, 2)));
-}
-
-pair<Vector2f, Vector2f> physics::bounceDirection(const Enemy* thisEnemy, const Enemy* otherEnemy,const float& separationDistance)
-{
-	const Vector2f normal = physics::normalize(thisEnemy->position - otherEnemy->position);
-
-	// Calculate overlap distance
-	const auto overlap = (thisEnemy->size + otherEnemy->size) - physics::distance(thisEnemy->position, otherEnemy->position);
-
-	// Separate the asteroids along the collision normal to resolve overlap
-	const Vector2f separationVector = normal * overlap * separationDistance;
-
-	// Calculate relative velocity along the normal direction
-	const Vector2f relativeVelocity = static_cast<float>(thisEnemy->speed) * physics::normalize(thisEnemy->direction) - static_cast<float>(otherEnemy->speed) * physics::normalize(otherEnemy->direction);
-	const auto velAlongNormal = physics::dotProduct(relativeVelocity, normal);
-
-	// Calculate total mass
-	const auto totalMass = thisEnemy->size + otherEnemy->size;
-
-	// Calculate the maximum change in direction allowed
-	const auto maxChangeFactor = 0.7f;
-	const auto maxChangeMagnitude = maxChangeFactor * velAlongNormal / totalMass;
-
-	// Calculate the change in direction based on momentum conservation, limited by the maximum change
-	return pair(min(maxChangeMagnitude, abs(velAlongNormal)) * normal, separationVector);
+	return length(p2 - p1);
 }
 
 float physics::getRandomFloatValue(const float& base) {
@@ -10,6 +10,7 @@ class Enemy;
 
 namespace physics {
 	bool intersects(const Vector2f& point, const float& size, const Vector2f& circlePosition, const float& size2);
+	float sweep(const Vector2f& start, const Vector2f& end, const float& size, const Vector2f& circlePosition, const float& size2);
 	float length(const Vector2f& v);
 	Vector2f normalize(const Vector2f& v);
 
@@ -23,7 +24,6 @@ namespace physics {
 	float magnitude(const Vector2f& vec);
 	float dotProduct(const Vector2f& v1, const Vector2f& v2);
 	float distance(const Vector2f& p1, const Vector2f& p2);
-	pair<Vector2f, Vector2f> bounceDirection(const Enemy* thisEnemy, const Enemy* otherEnemy, const float& separationDistance);
 
 	float getRandomFloatValue(const float& base);
 	float getRandomFloatValue(const float& base, const float& range);
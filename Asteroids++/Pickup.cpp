@@ -1,5 +1,6 @@
 #include "Pickup.h"
 #include "WindowBox.h"
+#include "Gravity.h"
 
 const map<double, Sprites> Pickup::boosters{
 	{ 0.01, Sprites::HEART1UP },
@@ -30,6 +31,7 @@ lifeTime(5.0f)
 
 	collected = getSprite(Sprites::COLLECTED);
 	drawHitboxes(radius / 2);
+	setLayer(LAYER_PICKUP);
 
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 }
@@ -40,11 +42,12 @@ lifeTime(5.0f)
 	spriteInfo = getSprite(spriteType);
 	collected = getSprite(Sprites::COLLECTED);
 	drawHitboxes(radius / 2);
+	setLayer(LAYER_PICKUP);
 
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 }
 
-void Pickup::render(RenderWindow& window)
+void Pickup::render(RenderList& window)
 {
 	Transform transform;
 	window.draw(spriteInfo.sprite, transform.translate(position));
@@ -67,6 +70,9 @@ void Pickup::update(float deltaTime)
 
 	if (Game::freeze.isEffectActive()) return;
 
+	velocity += Gravity::getAcceleration(position) * deltaTime;
+	position += velocity * deltaTime;
+
 	if(spriteInfo.frames.size() != 0) setSpriteFullCycle(deltaTime);
 }
 
@@ -77,138 +83,143 @@ const EntityType Pickup::getEntityType()
 
 void Pickup::collisionDetection()
 {
+	vector<Contact> contacts;
+
 	Game::foreachEntity([&](Entity* entity) {
-		if (entity->getEntityType() == EntityType::TYPE_PLAYER && entity != this) {
-			Player* player = dynamic_cast<Player*>(entity);
-
-			if (!player) return;
-
-			if (physics::intersects(this->position, static_cast<float>(this->radius), player->position, player->radius) && static_cast<float>(lifeTime) > 0) {
-				lifeTime = 0;
-
-				switch (spriteInfo.spriteType)
-				{
-				case Sprites::PICKUP_EXTRA_BULLET:
-					if (Player::playerStats.shootOffset >= 0.17f) {
-						Player::playerStats.shootOffset -= 0.01f;
-						Player::playerStats.bulletSize += 3.0f;
-						Player::playerStats.critChance += 0.03;
-					}
-
-					Player::playerStats.bulletDamage += 50.0f;
-					SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
-
-					break;
-				case Sprites::PICKUP_EXTRA_SPEED:
-					if (Player::playerStats.speed < 500.0f) {
-						Player::playerStats.speed += 15.0f;
-						Player::playerStats.turnSpeed += 5.0f;
-						Player::playerStats.bulletSpeed += 25.0f;
-					}
-					SoundData::play(Sounds::PICKUP_EXTRA_SPEED);
-
-					break;
-				case Sprites::PICKUP_SHIELD:
-					Player::playerStats.shield.startEffect(15.0f + Player::playerStats.time);
-					Player::playerStats.shield.getBar()->setMaxValue(Player::playerStats.shield.getEffectDuration());
-
-					SoundData::play(Sounds::PICKUP_SHIELD);
-					SoundData::sounds[Sounds::ACTIVE_SHIELD].setVolume(100);
-					SoundData::playLooped(Sounds::ACTIVE_SHIELD);
-
-					break;
-				case Sprites::PICKUP_DRUNKMODE:
-					Player::playerStats.drunkMode.startEffect(2.0f + Player::playerStats.time);
-					Player::playerStats.drunkMode.getBar()->setMaxValue(Player::playerStats.drunkMode.getEffectDuration());
-
-					SoundData::play(Sounds::PICKUP_DRUNKMODE);
-
-					break;
-				case Sprites::PICKUP_PIERCING:
-					Player::resetBulletEffect();
-					Player::playerStats.bulletType = PIERCING;
-
-					SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
-
-					break;
-				case Sprites::PICKUP_HOMING:
-					Player::resetBulletEffect();
-					Player::playerStats.bulletType = HOMING;
-
-					SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
-
-					break;
-				case Sprites::PICKUP_POISON:
-					Player::resetBulletEffect();
-					Player::playerStats.bulletType = POISON;
-
-					SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
-
-					break;
-				case Sprites::HEART1UP:
-					if (Player::playerStats.lifes.size() <= 5) {
-						Player::playerStats.lifes.push_back(Player::playerStats.lifes.back().offset + 20.0f);
-						for (auto& life : Player::playerStats.lifes)
-							life.setSpriteState(0);
-					}
-					SoundData::play(Sounds::HEART1UP);
-
-					break;
-				case Sprites::PICKUP_FREEZE:
-					if (SoundData::sounds[Sounds::AMBIENT].getStatus() != Sound::Playing) {
-						SoundData::recoverSound(Sounds::AMBIENT);
-						SoundData::renev(Sounds::AMBIENT);
-					}
-
-					SoundData::play(Sounds::FREEZE);
-					Game::setGameState(FREZZE);
-					Game::freeze.startEffect(physics::getRandomFloatValue(5.0f, 0.5f) + Player::playerStats.time);
-
-					break;
-				case Sprites::PICKUP_EXTRA_TIME:
-					SoundData::play(Sounds::PICKUP_EXTRA_TIME);
-					if (Player::playerStats.time < 10.0f) Player::playerStats.time += 1.0f;
-
-					break;
-				case Sprites::PICKUP_TIMES_2:
-					SoundData::play(Sounds::PICKUP_TIMES_2);
-					if (Player::playerStats.scoreTimes5.isEffectActive()) Player::playerStats.scoreTimes5.setEffectActive(false);
-					Player::playerStats.scoreTimes2.startEffect(physics::getRandomFloatValue(10.0f, 0.5f) + Player::playerStats.time);
-					Player::playerStats.scoreTimes2.getBar()->setMaxValue(Player::playerStats.scoreTimes2.getEffectDuration());
-
-					break;
-				case Sprites::PICKUP_TIMES_5:
-					SoundData::play(Sounds::PICKUP_TIMES_5);
-					if (Player::playerStats.scoreTimes2.isEffectActive()) Player::playerStats.scoreTimes2.setEffectActive(false);
-					Player::playerStats.scoreTimes5.startEffect(physics::getRandomFloatValue(10.0f, 0.5f) + Player::playerStats.time);
-					Player::playerStats.scoreTimes5.getBar()->setMaxValue(Player::playerStats.scoreTimes5.getEffectDuration());
-
-					break;
-
-				case Sprites::PICKUP_DOUBLESHOOT:
-					SoundData::play(Sounds::PICKUP_DOUBLESHOOT);
-					Player::playerStats.bulletAmount = 2;
-
-					break;
-
-				case Sprites::PICKUP_TRIPLESHOOT:
-					SoundData::play(Sounds::PICKUP_TRIPLESHOOT);
-					Player::playerStats.bulletAmount = 3;
-
-					break;
-
-				case Sprites::PICKUP_QUADSHOOT:
-					SoundData::play(Sounds::PICKUP_QUADSHOOT);
-					Player::playerStats.bulletAmount = 4;
-
-					break;
-				}
-
-				Score::addScore(spriteInfo.spriteType);
-				Game::addEntity(new Explosion(this->position, this->size, collected));
-			}
-		}
+		if (entity != this && collidesWith(entity) && physics::intersects(position, radius, entity->position, entity->radius)) CollisionMatrix::report(this, entity, contacts);
 	});
+
+	CollisionMatrix::submit(contacts);
+}
+
+void Pickup::collect()
+{
+	if (lifeTime <= 0) return;
+
+	lifeTime = 0;
+
+	switch (spriteInfo.spriteType)
+	{
+	case Sprites::PICKUP_EXTRA_BULLET:
+		if (Player::playerStats.shootOffset >= 0.17f) {
+			Player::playerStats.shootOffset -= 0.01f;
+			Player::playerStats.bulletSize += 3.0f;
+			Player::playerStats.critChance += 0.03;
+		}
+
+		Player::playerStats.bulletDamage += 50.0f;
+		SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
+
+		break;
+	case Sprites::PICKUP_EXTRA_SPEED:
+		if (Player::playerStats.speed < 500.0f) {
+			Player::playerStats.speed += 15.0f;
+			Player::playerStats.turnSpeed += 5.0f;
+			Player::playerStats.bulletSpeed += 25.0f;
+		}
+		SoundData::play(Sounds::PICKUP_EXTRA_SPEED);
+
+		break;
+	case Sprites::PICKUP_SHIELD:
+		Player::playerStats.shield.startEffect(15.0f + Player::playerStats.time);
+		Player::playerStats.shield.getBar()->setMaxValue(Player::playerStats.shield.getEffectDuration());
+
+		SoundData::play(Sounds::PICKUP_SHIELD);
+		SoundData::sounds[Sounds::ACTIVE_SHIELD].setVolume(100);
+		SoundData::playLooped(Sounds::ACTIVE_SHIELD);
+
+		break;
+	case Sprites::PICKUP_DRUNKMODE:
+		Player::playerStats.drunkMode.startEffect(2.0f + Player::playerStats.time);
+		Player::playerStats.drunkMode.getBar()->setMaxValue(Player::playerStats.drunkMode.getEffectDuration());
+
+		SoundData::play(Sounds::PICKUP_DRUNKMODE);
+
+		break;
+	case Sprites::PICKUP_PIERCING:
+		Player::resetBulletEffect();
+		Player::playerStats.bulletType = PIERCING;
+
+		SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
+
+		break;
+	case Sprites::PICKUP_HOMING:
+		Player::resetBulletEffect();
+		Player::playerStats.bulletType = HOMING;
+
+		SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
+
+		break;
+	case Sprites::PICKUP_POISON:
+		Player::resetBulletEffect();
+		Player::playerStats.bulletType = POISON;
+
+		SoundData::play(Sounds::PICKUP_EXTRA_BULLET);
+
+		break;
+	case Sprites::HEART1UP:
+		if (Player::playerStats.lifes.size() <= 5) {
+			Player::playerStats.lifes.push_back(Player::playerStats.lifes.back().offset + 20.0f);
+			for (auto& life : Player::playerStats.lifes)
+				life.setSpriteState(0);
+		}
+		SoundData::play(Sounds::HEART1UP);
+
+		break;
+	case Sprites::PICKUP_FREEZE:
+		if (SoundData::sounds[Sounds::AMBIENT].getStatus() != Sound::Playing) {
+			SoundData::recoverSound(Sounds::AMBIENT);
+			SoundData::renev(Sounds::AMBIENT);
+		}
+
+		SoundData::play(Sounds::FREEZE);
+		Game::setGameState(FREZZE);
+		Game::freeze.startEffect(physics::getRandomFloatValue(5.0f, 0.5f) + Player::playerStats.time);
+
+		break;
+	case Sprites::PICKUP_EXTRA_TIME:
+		SoundData::play(Sounds::PICKUP_EXTRA_TIME);
+		if (Player::playerStats.time < 10.0f) Player::playerStats.time += 1.0f;
+
+		break;
+	case Sprites::PICKUP_TIMES_2:
+		SoundData::play(Sounds::PICKUP_TIMES_2);
+		if (Player::playerStats.scoreTimes5.isEffectActive()) Player::playerStats.scoreTimes5.setEffectActive(false);
+		Player::playerStats.scoreTimes2.startEffect(physics::getRandomFloatValue(10.0f, 0.5f) + Player::playerStats.time);
+		Player::playerStats.scoreTimes2.getBar()->setMaxValue(Player::playerStats.scoreTimes2.getEffectDuration());
+
+		break;
+	case Sprites::PICKUP_TIMES_5:
+		SoundData::play(Sounds::PICKUP_TIMES_5);
+		if (Player::playerStats.scoreTimes2.isEffectActive()) Player::playerStats.scoreTimes2.setEffectActive(false);
+		Player::playerStats.scoreTimes5.startEffect(physics::getRandomFloatValue(10.0f, 0.5f) + Player::playerStats.time);
+		Player::playerStats.scoreTimes5.getBar()->setMaxValue(Player::playerStats.scoreTimes5.getEffectDuration());
+
+		break;
+
+	case Sprites::PICKUP_DOUBLESHOOT:
+		SoundData::play(Sounds::PICKUP_DOUBLESHOOT);
+		Player::playerStats.bulletAmount = 2;
+
+		break;
+
+	case Sprites::PICKUP_TRIPLESHOOT:
+		SoundData::play(Sounds::PICKUP_TRIPLESHOOT);
+		Player::playerStats.bulletAmount = 3;
+
+		break;
+
+	case Sprites::PICKUP_QUADSHOOT:
+		SoundData::play(Sounds::PICKUP_QUADSHOOT);
+		Player::playerStats.bulletAmount = 4;
+
+		break;
+	default:
+		break;
+	}
+
+	Score::addScore(spriteInfo.spriteType);
+	Game::addEntity(new Explosion(this->position, this->size, collected));
 }
 
 const Sprites Pickup::getRandomDrop(const map<double, Sprites>& group)
@@ -7,16 +7,18 @@
 #include "Game.h"
 #include "Player.h"
 #include "Score.h"
+#include "CollisionMatrix.h"
 
 class Pickup : public Entity {
 public:
     Pickup(Vector2f position);
     Pickup(Vector2f position, Sprites spriteType);
 
-    void render(RenderWindow& window) override;
+    void render(RenderList& window) override;
     void update(float deltaTime) override;
     const EntityType getEntityType() override;
     void collisionDetection() override;
+    void collect();
 
     const static Sprites getRandomDrop(const map<double, Sprites>& group);
 
@@ -29,6 +31,7 @@ private:
 
     SpriteInfo collected;
     double lifeTime;
+    Vector2f velocity;
 };
 
 #endif
\ No newline at end of file
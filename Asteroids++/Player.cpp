@@ -1,10 +1,16 @@
 #include "Player.h"
 #include "MultiAsteroid.h"
 #include "SingleAsteroid.h"
-#include "SingleBullet.h"
+#include "Projectiles.h"
 #include "WindowBox.h"
 #include "Particle.h"
 #include "DeathScreen.h"
+#include "QualityGovernor.h"
+#include "Tweens.h"
+
+// The ship stays tinted while invincible and fades back once it runs out
+const Color invincibleColor(48, 218, 255, 255);
+const float invincibleFadeTime = 1.0f;
 
 Effect Player::dash({ 0.0f, false });
 PlayerStats Player::playerStats{};
@@ -18,15 +24,19 @@ Player::Player() :
         getSprite(Sprites::SHIP)
     ),
     shootTimer(),
-    invincibilityFrames({ 0.0f, false }),
-    dead(false)
+    delay(0.0f, false, GameClock::GAME),
+    invincibilityFrames(0.0f, false, GameClock::GAME),
+    dead(false),
+    fadeTimer(0),
+    dashTrack(0)
 {
     shieldSprite = getSprite(Sprites::SHIELD);
 	drawHitboxes();
+    setLayer(LAYER_PLAYER);
     setPlayerStats();
 }
 
-void Player::render(RenderWindow& window)
+void Player::render(RenderList& window)
 {
     if (delay.isEffectActive() || dead) return;
 
@@ -50,27 +60,28 @@ void Player::update(float deltaTime) {
         return;
     }
 
-    invincibilityFrames.updateEffectDuration(deltaTime);
-    delay.updateEffectDuration(deltaTime);
-
     if (delay.isEffectActive()) return;
 
     shootTimer -= deltaTime; 
-    dash.updateEffectDuration(deltaTime);
 
     spriteInfo.currentSpriteLifeTime -= deltaTime;
 
     updatePosition(deltaTime);
-    updateStatsbars(deltaTime);
+    updateStatsbars();
     dashAbility(deltaTime);
 
-    if (dash.isEffectActive()) Game::addParticle(new Particle(position, angle, Sprites::SHIP, Color(126, 193, 255, 100), 0.15));
+    QualityGovernor::setFocus(position);
+
+    if (dash.isEffectActive() && QualityGovernor::shouldEmitParticle()) Game::addParticle(new Particle(position, angle, Sprites::SHIP, Color(126, 193, 255, 100), 0.15));
 
-    if (Keyboard::isKeyPressed(Keyboard::Space) && shootTimer <= 0.0f) {
+    const auto& input = Input::getSnapshot();
+
+    // A tap shorter than a tick never shows as held, only as pressed
+    if ((input.isDown(Action::SHOOT) || input.isPressed(Action::SHOOT)) && shootTimer <= 0.0f) {
         shootTimer = Player::playerStats.shootOffset;
 
         if (playerStats.bulletAmount == 1) {
-            Game::addEntity(new SingleBullet(position, physics::calculateDirection(angle), angle));
+            Projectiles::fire(Faction::PLAYER, position, physics::calculateDirection(angle), angle);
             SoundData::play(Sounds::LASER_SHOOT1);
         }
 
@@ -87,8 +98,8 @@ void Player::update(float deltaTime) {
             float leftBulletAngle = angle - physics::floatToAngle(bulletSpreadAngle);
             float rightBulletAngle = angle + physics::floatToAngle(bulletSpreadAngle);
 
-            Game::addEntity(new SingleBullet(leftBulletPosition, leftBulletDirection, leftBulletAngle));
-            Game::addEntity(new SingleBullet(rightBulletPosition, rightBulletDirection, rightBulletAngle));
+            Projectiles::fire(Faction::PLAYER, leftBulletPosition, leftBulletDirection, leftBulletAngle);
+            Projectiles::fire(Faction::PLAYER, rightBulletPosition, rightBulletDirection, rightBulletAngle);
 
             SoundData::play(Sounds::LASER_SHOOT2);
         }
@@ -105,9 +116,9 @@ void Player::update(float deltaTime) {
             float leftAngle = angle - physics::floatToAngle(bulletSpreadAngle);
             float rightAngle = angle + physics::floatToAngle(bulletSpreadAngle);
 
-            Game::addEntity(new SingleBullet(position, physics::calculateDirection(angle), angle));
-            Game::addEntity(new SingleBullet(leftBulletPosition, leftBulletDirection, leftAngle));
-            Game::addEntity(new SingleBullet(rightBulletPosition, rightBulletDirection, rightAngle));
+            Projectiles::fire(Faction::PLAYER, position, physics::calculateDirection(angle), angle);
+            Projectiles::fire(Faction::PLAYER, leftBulletPosition, leftBulletDirection, leftAngle);
+            Projectiles::fire(Faction::PLAYER, rightBulletPosition, rightBulletDirection, rightAngle);
 
             SoundData::play(Sounds::LASER_SHOOT3);
         }
@@ -127,67 +138,41 @@ void Player::update(float deltaTime) {
             float rightAngle = angle + physics::floatToAngle(bulletSpreadAngle);
             float backAngle = physics::floatToAngle(backBulletAngle);
 
-            Game::addEntity(new SingleBullet(position, physics::calculateDirection(angle), angle));
-            Game::addEntity(new SingleBullet(leftBulletPosition, leftBulletDirection, leftAngle));
-            Game::addEntity(new SingleBullet(rightBulletPosition, rightBulletDirection, rightAngle));
-            Game::addEntity(new SingleBullet(position, { cos(backBulletAngle), sin(backBulletAngle) }, backAngle));
+            Projectiles::fire(Faction::PLAYER, position, physics::calculateDirection(angle), angle);
+            Projectiles::fire(Faction::PLAYER, leftBulletPosition, leftBulletDirection, leftAngle);
+            Projectiles::fire(Faction::PLAYER, rightBulletPosition, rightBulletDirection, rightAngle);
+            Projectiles::fire(Faction::PLAYER, position, { cos(backBulletAngle), sin(backBulletAngle) }, backAngle);
 
             SoundData::play(Sounds::LASER_SHOOT4);
         }
     }
 
-    if (invincibilityFrames.isEffectActive()) {
-        thread t([&]() {
-            Clock clock;
-            spriteInfo.sprite.setColor(Color::Red);
-
-            Color startColor = Color(48,218,255,255);
-            Color endColor = Color::White;
-
-                while (clock.getElapsedTime().asSeconds() < 1.0f) {
-                    float progress = clock.getElapsedTime().asSeconds() / 1.0f;
-                    Color interpolatedColor = Color(
-                        static_cast<Uint8>(startColor.r + progress * (endColor.r - startColor.r)),
-                        static_cast<Uint8>(startColor.g + progress * (endColor.g - startColor.g)),
-                        static_cast<Uint8>(startColor.b + progress * (endColor.b - startColor.b)),
-                        static_cast<Uint8>(startColor.a + progress * (endColor.a - startColor.a)));
-                    spriteInfo.sprite.setColor(interpolatedColor);
-
-                    this_thread::sleep_for(chrono::milliseconds(20));
-                }
-            spriteInfo.sprite.setColor(Color::White);
-        });
-
-        t.detach();
-    }
-
     if (playerStats.shield.isEffectActive()) {
         shieldSprite.currentSpriteLifeTime -= deltaTime;
-        playerStats.shield.updateEffectDuration(deltaTime);
 
         setSpriteFullCycle(shieldSprite);
     }
-
-    if (!invincibilityFrames.isEffectActive() && !playerStats.shield.isEffectActive()) collisionDetection();
 }
 
 void Player::updatePosition(const float& deltaTime) {
+    const auto& input = Input::getSnapshot();
+
     if (!dash.isEffectActive()) {
         float turnDirection = 0.0f;
 
         if (playerStats.drunkMode.isEffectActive()) {
-            if (Keyboard::isKeyPressed(Keyboard::D)) {
+            if (input.isDown(Action::TURN_RIGHT)) {
                 turnDirection -= 1.0f;
             }
-            if (Keyboard::isKeyPressed(Keyboard::A)) {
+            if (input.isDown(Action::TURN_LEFT)) {
                 turnDirection += 1.0f;
             }
         }
         else {
-            if (Keyboard::isKeyPressed(Keyboard::A)) {
+            if (input.isDown(Action::TURN_LEFT)) {
                 turnDirection -= 1.0f;
             }
-            if (Keyboard::isKeyPressed(Keyboard::D)) {
+            if (input.isDown(Action::TURN_RIGHT)) {
                 turnDirection += 1.0f;
             }
         }
@@ -195,14 +180,14 @@ void Player::updatePosition(const float& deltaTime) {
         angle += playerStats.turnSpeed * turnDirection * deltaTime;
     }
 
-    if (Keyboard::isKeyPressed(Keyboard::W)) {
+    if (input.isDown(Action::THRUST)) {
         float radians = angle * (physics::getPI() / 180.0f);
 
         position.x += cos(radians) * playerStats.speed * deltaTime;
         position.y += sin(radians) * playerStats.speed * deltaTime;
     }
 
-    if (Keyboard::isKeyPressed(Keyboard::S)) {
+    if (input.isDown(Action::REVERSE)) {
         float radians = angle * (physics::getPI() / 180.0f);
 
         position.x -= cos(radians) * playerStats.speed * deltaTime;
@@ -220,20 +205,37 @@ const EntityType Player::getEntityType()
 
 void Player::collisionDetection()
 {
-    Game::foreachEntity([this](Entity* entity) {
-        if (!Game::isEntityInsideGruop(entity, Enemy::enemies) || entity == this || dead) return;
+    if (dead || invincibilityFrames.isEffectActive() || playerStats.shield.isEffectActive()) return;
+
+    const auto& enemies = Game::getEnemyBatch();
 
-            if (!physics::intersects(position, radius, entity->position, entity->radius))
-                return;
+    vector<size_t> hits;
+    Narrowphase::query(position, radius, enemies, hits);
 
-            destroy();
-    });
+    vector<Contact> contacts;
+
+    for (const auto& hit : hits)
+    {
+        if (enemies.entities[hit]->isActive() && collidesWith(enemies.entities[hit])) CollisionMatrix::report(this, enemies.entities[hit], contacts);
+    }
+
+    CollisionMatrix::submit(contacts);
 }
 
 void Player::destroy() {
     if (invincibilityFrames.getEffectDuration() > 0) return;
 
-    invincibilityFrames.startEffect(FileMenager::timingsData.default_invincibility_frames_time);
+    const auto invincibleTime = FileMenager::timingsData.default_invincibility_frames_time;
+
+    invincibilityFrames.startEffect(invincibleTime);
+
+    Tweens::colour(this, invincibleColor, invincibleColor, 0.0f);
+    Timers::cancel(fadeTimer);
+    fadeTimer = Timers::after(invincibleTime, [this]() { Tweens::colour(this, invincibleColor, Color::White, invincibleFadeTime); });
+
+    Tweens::cancel(dashTrack);
+    dash.setEffectActive(false);
+
     playerStats.lifes.back().removeHealth();
     playerStats.lifes.back().setSpriteState(16);
     SoundData::play(Sounds::DESTROY);
@@ -251,37 +253,23 @@ void Player::dashAbility(const float& deltaTime)
 {
     const auto animationDuration = FileMenager::playerData.dash_duration;
 
-    if (Keyboard::isKeyPressed(Keyboard::R) && dash.getEffectDuration() < 0) {
+    const auto& input = Input::getSnapshot();
+
+    if ((input.isDown(Action::DASH) || input.isPressed(Action::DASH)) && dash.getEffectDuration() < 0) {
         dash.startEffect(FileMenager::playerData.dash_time_delay);
         invincibilityFrames.setEffectDuration(0.0f);
 
+        if (Timers::isPending(fadeTimer)) {
+            Timers::cancel(fadeTimer);
+            Tweens::colour(this, invincibleColor, Color::White, invincibleFadeTime);
+        }
+
         float radians = angle * (physics::getPI() / 180.0f);
 
         Vector2f endPoint(position.x + cos(radians) * size * FileMenager::playerData.dash_length, position.y + sin(radians) * size * FileMenager::playerData.dash_length);
 
         if(!invincibilityFrames.isEffectActive()) SoundData::play(Sounds::DASH_ABILITY);
-        thread animationThread([this, endPoint, animationDuration]() {
-            this_thread::sleep_for(chrono::milliseconds(50));
-            Clock clock;
-
-            while (true) {
-                float elapsedTime = clock.getElapsedTime().asSeconds();
-                float t = elapsedTime / animationDuration;
-                if (t > 1.0f) t = 1.0f;
-
-                Vector2f interpolatedPosition = position + (endPoint - position) * t;
-                position = interpolatedPosition;
-
-                if (t >= animationDuration || invincibilityFrames.isEffectActive()) {
-                    dash.setEffectActive(false);
-                    break;
-                }
-
-                this_thread::sleep_for(chrono::milliseconds(10));
-            }
-        });
-
-        animationThread.detach();
+        dashTrack = Tweens::position(this, endPoint, animationDuration, 0.05f, []() { dash.setEffectActive(false); });
     }
 }
 
@@ -307,12 +295,14 @@ void Player::setPlayerStats()
     
     setHealth();
 
+    dash = { 0.0f, false, GameClock::GAME };
+
     playerStats.speed = pd.speed;
     playerStats.turnSpeed = pd.turn_speed;
-    playerStats.shield = { td.default_shield_time, false, new Bar(radius, 2.0f, Color::Blue, Color::Black, playerStats.shield.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_SHIELD)};
-    playerStats.drunkMode = { td.default_drunkMode_time, false, new Bar(radius, 2.0f, Color(242, 142, 28, 255), Color::Black, playerStats.drunkMode.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_DRUNKMODE) };
-    playerStats.scoreTimes2 = { td.default_scoreTimes2_time, false, new Bar(radius, 2.0f, Color(144, 238, 144, 255), Color::Black, playerStats.scoreTimes2.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_TIMES_2) };
-    playerStats.scoreTimes5 = { td.default_scoreTimes5_time, false, new Bar(radius, 2.0f, Color(93, 213, 93, 255), Color::Black, playerStats.scoreTimes5.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_TIMES_5) };
+    playerStats.shield = { td.default_shield_time, false, new Bar(radius, 2.0f, Color::Blue, Color::Black, playerStats.shield.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_SHIELD), GameClock::GAME };
+    playerStats.drunkMode = { td.default_drunkMode_time, false, new Bar(radius, 2.0f, Color(242, 142, 28, 255), Color::Black, playerStats.drunkMode.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_DRUNKMODE), GameClock::GAME };
+    playerStats.scoreTimes2 = { td.default_scoreTimes2_time, false, new Bar(radius, 2.0f, Color(144, 238, 144, 255), Color::Black, playerStats.scoreTimes2.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_TIMES_2), GameClock::GAME };
+    playerStats.scoreTimes5 = { td.default_scoreTimes5_time, false, new Bar(radius, 2.0f, Color(93, 213, 93, 255), Color::Black, playerStats.scoreTimes5.getEffectDuration(), Vector2f(-100.0f, -100.0f), Sprites::PICKUP_TIMES_5), GameClock::GAME };
     playerStats.critChance = pd.player_crit_chance;
 
     playerStats.bulletType = static_cast<BulletType>(pd.player_bullet_type);
@@ -322,24 +312,7 @@ void Player::resetBulletEffect() {
     playerStats.bulletType = NORMAL;
 }
 
-Sprites Player::getPlayerBulletSprite()
-{
-    switch (playerStats.bulletType)
-    {
-    case NORMAL:
-        return Sprites::SINGLE_BULLET;
-    case PIERCING:
-        return Sprites::PIERCING_BULLET;
-    case HOMING:
-        return Sprites::HOMING_BULLET;
-    case POISON:
-        return Sprites::POISON_BULLET;
-    default:
-        return Sprites::SINGLE_BULLET;
-    }
-}
-
-void Player::updateStatsbars(const float& deltaTime) {
+void Player::updateStatsbars() {
     float offset = 0.0f;
     playerStats.drunkMode.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
     playerStats.shield.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
@@ -347,8 +320,6 @@ void Player::updateStatsbars(const float& deltaTime) {
     playerStats.scoreTimes5.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
 
     if (playerStats.drunkMode.isEffectActive()) {
-        playerStats.drunkMode.updateEffectDuration(deltaTime);
-
         playerStats.drunkMode.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
         playerStats.drunkMode.getBar()->updateValue(playerStats.drunkMode.getEffectDuration());
 
@@ -356,8 +327,6 @@ void Player::updateStatsbars(const float& deltaTime) {
     }
 
     if (playerStats.shield.isEffectActive()) {
-        playerStats.shield.updateEffectDuration(deltaTime);
-
         playerStats.shield.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
         playerStats.shield.getBar()->updateValue(playerStats.shield.getEffectDuration());
 
@@ -367,8 +336,6 @@ void Player::updateStatsbars(const float& deltaTime) {
     if (!playerStats.shield.isEffectActive()) SoundData::stop(Sounds::ACTIVE_SHIELD);
 
     if (playerStats.scoreTimes2.isEffectActive()) {
-        playerStats.scoreTimes2.updateEffectDuration(deltaTime);
-
         playerStats.scoreTimes2.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
         playerStats.scoreTimes2.getBar()->updateValue(playerStats.scoreTimes2.getEffectDuration());
 
@@ -376,8 +343,6 @@ void Player::updateStatsbars(const float& deltaTime) {
     }
 
     if (playerStats.scoreTimes5.isEffectActive()) {
-        playerStats.scoreTimes5.updateEffectDuration(deltaTime);
-
         playerStats.scoreTimes5.getBar()->updatePosition(Vector2f{ position.x - radius / 2, position.y + radius + offset });
         playerStats.scoreTimes5.getBar()->updateValue(playerStats.scoreTimes5.getEffectDuration());
 
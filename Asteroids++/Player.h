@@ -7,7 +7,7 @@
 #include "Game.h"
 #include "FileMenager.h"
 #include "Bar.h"
-#include "Bullet.h"
+#include "Explosion.h"
 #include "Enemy.h"
 #include "Physics.h"
 #include "SoundData.h"
@@ -48,12 +48,11 @@ class Player : public Entity {
 public:
 	Player();
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	void update(float deltaTime) override;
 	const EntityType getEntityType() override;
 	void collisionDetection() override;
 
-	static Sprites getPlayerBulletSprite();
 	void destroy();
 
 	static void setHealth();
@@ -68,12 +67,15 @@ private:
 	Effect delay;
 	Effect invincibilityFrames;
 
-	void updateStatsbars(const float& deltaTime);
+	void updateStatsbars();
 	void updatePosition(const float& deltaTime);
 	void dashAbility(const float& deltaTime);
 	void setPlayerStats();
 
 	float shootTimer;
+
+	uint32_t fadeTimer;
+	uint32_t dashTrack;
 };
 
 #endif
\ No newline at end of file
@@ -22,7 +22,7 @@ void PlayerHealthUI::update(float deltaTime)
 	}
 }
 
-void PlayerHealthUI::draw(RenderWindow& window) const
+void PlayerHealthUI::draw(RenderList& window) const
 {
 	if (removeHealthFromPlayer && spriteInfo.spriteState == spriteInfo.frames.size() - 1) {
 		Player::playerStats.lifes.pop_back();
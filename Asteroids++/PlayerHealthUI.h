@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "SpriteData.h"
+#include "RenderList.h"
 
 using namespace sf;
 using namespace std;
@@ -18,7 +19,7 @@ public:
     PlayerHealthUI(const float& offset);
 
     void update(float deltaTime);
-    void draw(RenderWindow& window) const;
+    void draw(RenderList& window) const;
     void setSpriteState(const int& newState);
 
     void removeHealth();
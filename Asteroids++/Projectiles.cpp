@@ -0,0 +1,534 @@
+#include "Projectiles.h"
+#include "Game.h"
+#include "Player.h"
+#include "Enemy.h"
+#include "BlackHole.h"
+#include "DeathScreen.h"
+#include "CommandBuffer.h"
+#include "SoundData.h"
+#include "Physics.h"
+#include "CollisionMatrix.h"
+#include "Gravity.h"
+#include "StatusEffects.h"
+
+array<ProjectilePool, static_cast<size_t>(ProjectileKind::COUNT)> Projectiles::pools;
+unordered_map<Sprites, Sprite> Projectiles::looks;
+
+const uint8_t retargetFrames = 8;
+
+const array<Sprites, static_cast<size_t>(ProjectileKind::COUNT)> kindSprites = {
+	Sprites::SINGLE_BULLET,
+	Sprites::PIERCING_BULLET,
+	Sprites::HOMING_BULLET,
+	Sprites::POISON_BULLET,
+	Sprites::ENEMY_BULLET
+};
+
+const bool ProjectileHits::contains(const Entity* entity) const
+{
+	for (uint8_t i = 0; i < count; i++)
+		if (entities[i] == entity) return true;
+
+	return false;
+}
+
+void ProjectileHits::add(const Entity* entity)
+{
+	entities[next] = entity;
+	next = (next + 1) % capacity;
+	count = min<uint8_t>(count + 1, capacity);
+}
+
+void ProjectilePool::add(const Vector2f& position, const Vector2f& direction, const float& bulletAngle, const float& radius, const float& bulletScale, const float& bulletLifeTime)
+{
+	circles.x.push_back(position.x);
+	circles.y.push_back(position.y);
+	circles.radius.push_back(radius);
+	previousX.push_back(position.x);
+	previousY.push_back(position.y);
+	directionX.push_back(direction.x);
+	directionY.push_back(direction.y);
+	angle.push_back(bulletAngle);
+	scale.push_back(bulletScale);
+	lifeTime.push_back(bulletLifeTime);
+	hits.push_back({});
+	targets.push_back(nullptr);
+	retargetIn.push_back(0);
+}
+
+// Grows like push_back would, so firing volleys every frame doesn't reallocate on each one
+void ProjectilePool::reserve(const size_t& count)
+{
+	if (count <= circles.x.capacity()) return;
+
+	const auto capacity = max(count, circles.x.capacity() * 2);
+
+	circles.x.reserve(capacity);
+	circles.y.reserve(capacity);
+	circles.radius.reserve(capacity);
+	previousX.reserve(capacity);
+	previousY.reserve(capacity);
+	directionX.reserve(capacity);
+	directionY.reserve(capacity);
+	angle.reserve(capacity);
+	scale.reserve(capacity);
+	lifeTime.reserve(capacity);
+	hits.reserve(capacity);
+	targets.reserve(capacity);
+	retargetIn.reserve(capacity);
+}
+
+// Swaps the last bullet into the gap, so order isn't kept
+void ProjectilePool::remove(const size_t& bullet)
+{
+	const auto last = size() - 1;
+
+	circles.x[bullet] = circles.x[last];
+	circles.y[bullet] = circles.y[last];
+	circles.radius[bullet] = circles.radius[last];
+	previousX[bullet] = previousX[last];
+	previousY[bullet] = previousY[last];
+	directionX[bullet] = directionX[last];
+	directionY[bullet] = directionY[last];
+	angle[bullet] = angle[last];
+	scale[bullet] = scale[last];
+	lifeTime[bullet] = lifeTime[last];
+	hits[bullet] = hits[last];
+	targets[bullet] = targets[last];
+	retargetIn[bullet] = retargetIn[last];
+
+	circles.x.pop_back();
+	circles.y.pop_back();
+	circles.radius.pop_back();
+	previousX.pop_back();
+	previousY.pop_back();
+	directionX.pop_back();
+	directionY.pop_back();
+	angle.pop_back();
+	scale.pop_back();
+	lifeTime.pop_back();
+	hits.pop_back();
+	targets.pop_back();
+	retargetIn.pop_back();
+}
+
+void ProjectilePool::clear()
+{
+	circles.clear();
+	previousX.clear();
+	previousY.clear();
+	directionX.clear();
+	directionY.clear();
+	angle.clear();
+	scale.clear();
+	lifeTime.clear();
+	hits.clear();
+	targets.clear();
+	retargetIn.clear();
+}
+
+const size_t ProjectilePool::size() const
+{
+	return lifeTime.size();
+}
+
+void ProjectilePool::rememberPositions()
+{
+	previousX = circles.x;
+	previousY = circles.y;
+}
+
+void StraightMovement::move(ProjectilePool& pool, const float& deltaTime, const float&)
+{
+	const auto step = Player::playerStats.bulletSpeed * deltaTime;
+
+	auto* x = pool.circles.x.data();
+	auto* y = pool.circles.y.data();
+	const auto* directionX = pool.directionX.data();
+	const auto* directionY = pool.directionY.data();
+
+	for (size_t i = 0; i < pool.size(); i++) {
+		x[i] += directionX[i] * step;
+		y[i] += directionY[i] * step;
+	}
+}
+
+// Flies straight for the first tenth of its lifetime, then steers into the nearest enemy it can reach in time
+void HomingMovement::move(ProjectilePool& pool, const float& deltaTime, const float& lifetime)
+{
+	StraightMovement::move(pool, deltaTime, lifetime);
+
+	const auto threshold = 0.9f * lifetime;
+
+	retarget(pool, threshold);
+
+	const auto speed = Player::playerStats.bulletSpeed;
+
+	for (size_t i = 0; i < pool.size(); i++) {
+		if (pool.lifeTime[i] <= 0 || pool.lifeTime[i] >= threshold || !pool.targets[i]) continue;
+
+		const auto homingTarget = pool.targets[i]->position;
+		Vector2f position(pool.circles.x[i], pool.circles.y[i]);
+
+		position += physics::normalize(homingTarget - position) * speed * deltaTime;
+		if (position.x != homingTarget.x) position += physics::calculateDirection(position, homingTarget) * speed * deltaTime;
+
+		pool.circles.x[i] = position.x;
+		pool.circles.y[i] = position.y;
+	}
+}
+
+// Targets are kept for a few frames and only picked again early when they die, all bullets due pick in one pass over the grid
+void HomingMovement::retarget(ProjectilePool& pool, const float& threshold)
+{
+	const auto& enemies = Game::getEnemyBatch();
+	const auto& grid = Game::getEnemyGrid();
+	const auto reach = FileMenager::timingsData.default_bullet_homing_time * Player::playerStats.bulletSpeed;
+
+	vector<size_t> due;
+
+	for (size_t i = 0; i < pool.size(); i++) {
+		if (pool.lifeTime[i] <= 0 || pool.lifeTime[i] >= threshold) continue;
+
+		if (pool.retargetIn[i] > 0) pool.retargetIn[i]--;
+		if (pool.retargetIn[i] == 0 || (pool.targets[i] && !pool.targets[i]->isActive())) due.push_back(i);
+	}
+
+	for (const auto& i : due) {
+		const auto target = grid.nearest(Vector2f(pool.circles.x[i], pool.circles.y[i]), reach);
+
+		pool.targets[i] = target == SpatialGrid::none ? nullptr : enemies.entities[target];
+		pool.retargetIn[i] = retargetFrames;
+	}
+}
+
+void StopOnHit::hit(Enemy*) {}
+
+void PierceOnHit::hit(Enemy*) {}
+
+void PoisonOnHit::hit(Enemy* enemy)
+{
+	StatusEffects::poison(enemy);
+}
+
+const float FixedLifetime::initial()
+{
+	return FileMenager::playerData.bullet_lifetime;
+}
+
+void FixedLifetime::tick(ProjectilePool& pool, const float& deltaTime)
+{
+	auto* lifeTime = pool.lifeTime.data();
+
+	for (size_t i = 0; i < pool.size(); i++) lifeTime[i] -= deltaTime;
+}
+
+void Projectiles::fire(const Faction& faction, const Vector2f& position, const Vector2f& direction, const float& angle)
+{
+	if (const auto buffer = CommandBuffer::getRecording()) return buffer->record([=]() { fire(faction, position, direction, angle); });
+
+	if (faction == Faction::PLAYER) {
+		const auto size = Player::playerStats.bulletSize;
+		auto& pool = getPool(static_cast<ProjectileKind>(Player::playerStats.bulletType));
+
+		pool.add(position, direction, angle, float(static_cast<int>(size) >> 1), size / int(FileMenager::playerData.bullet_size), FixedLifetime::initial());
+	}
+	else {
+		getPool(ProjectileKind::ENEMY).add(position, direction, angle, 8.0f, 1.0f, EnemyPolicy::lifetime::initial());
+	}
+}
+
+// A whole volley grows the pool once and is then appended bullet by bullet
+void Projectiles::fire(const Faction& faction, span<const Vector2f> positions, span<const Vector2f> directions, span<const float> angles)
+{
+	if (const auto buffer = CommandBuffer::getRecording()) {
+		return buffer->record([=, positions = vector<Vector2f>(positions.begin(), positions.end()), directions = vector<Vector2f>(directions.begin(), directions.end()), angles = vector<float>(angles.begin(), angles.end())]() {
+			fire(faction, positions, directions, angles);
+		});
+	}
+
+	auto& pool = getPool(faction == Faction::PLAYER ? static_cast<ProjectileKind>(Player::playerStats.bulletType) : ProjectileKind::ENEMY);
+	pool.reserve(pool.size() + positions.size());
+
+	for (size_t i = 0; i < positions.size(); i++) fire(faction, positions[i], directions[i], angles[i]);
+}
+
+template<typename Policy>
+void Projectiles::updatePlayerBullets(ProjectilePool& pool, const float& deltaTime)
+{
+	if (pool.size() == 0) return;
+
+	pool.rememberPositions();
+
+	Policy::lifetime::tick(pool, deltaTime);
+	bend(pool, deltaTime);
+	Policy::movement::move(pool, deltaTime, Policy::lifetime::initial());
+
+	hitEnemies<typename Policy::onHit>(pool);
+	expire(pool);
+}
+
+template<typename Policy>
+void Projectiles::updateEnemyBullets(ProjectilePool& pool, const float& deltaTime)
+{
+	if (pool.size() == 0) return;
+
+	pool.rememberPositions();
+
+	Policy::lifetime::tick(pool, deltaTime);
+	bend(pool, deltaTime);
+	Policy::movement::move(pool, deltaTime, Policy::lifetime::initial());
+
+	hitPlayer(pool);
+	absorb(pool);
+	expire(pool);
+}
+
+void Projectiles::update(const float& deltaTime)
+{
+	updatePlayerBullets<NormalPolicy>(getPool(ProjectileKind::NORMAL), deltaTime);
+	updatePlayerBullets<PiercingPolicy>(getPool(ProjectileKind::PIERCING), deltaTime);
+	updatePlayerBullets<HomingPolicy>(getPool(ProjectileKind::HOMING), deltaTime);
+	updatePlayerBullets<PoisonPolicy>(getPool(ProjectileKind::POISON), deltaTime);
+
+	updateEnemyBullets<EnemyPolicy>(getPool(ProjectileKind::ENEMY), deltaTime);
+}
+
+void Projectiles::expire(ProjectilePool& pool)
+{
+	for (size_t i = pool.size(); i-- > 0;)
+		if (pool.lifeTime[i] <= 0) pool.remove(i);
+}
+
+// Bullets keep their speed, black holes only turn them
+void Projectiles::bend(ProjectilePool& pool, const float& deltaTime)
+{
+	if (!Gravity::hasAttractors()) return;
+
+	const auto speed = Player::playerStats.bulletSpeed;
+
+	for (size_t i = 0; i < pool.size(); i++) {
+		const auto acceleration = Gravity::getAcceleration(Vector2f(pool.circles.x[i], pool.circles.y[i]));
+		const Vector2f previous(pool.directionX[i], pool.directionY[i]);
+		const auto direction = physics::normalize(previous * speed + acceleration * deltaTime);
+
+		pool.directionX[i] = direction.x;
+		pool.directionY[i] = direction.y;
+		pool.angle[i] += (atan2(direction.y, direction.x) - atan2(previous.y, previous.x)) * 180 / physics::getPI();
+	}
+}
+
+// Resolved right away rather than through the collision matrix, a bullet isn't an entity and whether it goes on
+// to the next enemy depends on the hits before it in the same sweep
+template<typename OnHit>
+void Projectiles::hitEnemies(ProjectilePool& pool)
+{
+	const auto& enemies = Game::getEnemyBatch();
+	const auto mask = CollisionMatrix::getMask(LAYER_PLAYER_BULLET);
+
+	vector<ProjectileContact> contacts;
+	sweep(pool, enemies, contacts);
+
+	for (const auto& [bullet, hit, time] : contacts)
+	{
+		if (!enemies.entities[hit]->isActive() || !(mask & enemies.entities[hit]->layer) || pool.lifeTime[bullet] <= 0) continue;
+
+		auto enemy = static_cast<Enemy*>(enemies.entities[hit]);
+
+		if constexpr (OnHit::pierces) {
+			if (pool.hits[bullet].contains(enemy)) continue;
+			pool.hits[bullet].add(enemy);
+		}
+		else {
+			pool.lifeTime[bullet] = 0;
+		}
+
+		enemyHit(enemy);
+		OnHit::hit(enemy);
+	}
+}
+
+void Projectiles::hitPlayer(ProjectilePool& pool)
+{
+	if (Player::playerStats.shield.isEffectActive() || !DeathScreen::isScreenOver()) return;
+
+	const auto player = Game::doesEntityExist(TYPE_PLAYER);
+	if (!player || !(CollisionMatrix::getMask(LAYER_ENEMY_BULLET) & player->layer)) return;
+
+	CircleBatch target;
+	target.add(player);
+
+	vector<ProjectileContact> contacts;
+	sweep(pool, target, contacts);
+
+	vector<Contact> crashes;
+
+	for (const auto& [bullet, hit, time] : contacts)
+	{
+		if (pool.lifeTime[bullet] <= 0) continue;
+
+		pool.lifeTime[bullet] = 0;
+
+		const Vector2f position(pool.circles.x[bullet], pool.circles.y[bullet]);
+		const auto normal = physics::normalize(position - player->position);
+
+		crashes.push_back({ player, nullptr, player->position + normal * player->radius, normal, ContactKind::CRASH });
+	}
+
+	CollisionMatrix::submit(crashes);
+}
+
+// Black holes swallow enemy bullets that get close to the center
+void Projectiles::absorb(ProjectilePool& pool)
+{
+	const auto& enemies = Game::getEnemyBatch();
+	const auto mask = CollisionMatrix::getMask(LAYER_ENEMY_BULLET);
+
+	CircleBatch cores;
+
+	// The only enemies enemy bullets collide with are black holes
+	for (size_t i = 0; i < enemies.size(); i++) {
+		if (!(mask & enemies.entities[i]->layer) || !enemies.entities[i]->isActive()) continue;
+
+		cores.x.push_back(enemies.x[i]);
+		cores.y.push_back(enemies.y[i]);
+		cores.radius.push_back(enemies.radius[i] / 2.0f);
+		cores.entities.push_back(enemies.entities[i]);
+	}
+
+	if (cores.size() == 0) return;
+
+	vector<ProjectileContact> contacts;
+	sweep(pool, cores, contacts);
+
+	for (const auto& [bullet, core, time] : contacts)
+	{
+		if (pool.lifeTime[bullet] <= 0) continue;
+
+		pool.lifeTime[bullet] = 0;
+		static_cast<BlackHole*>(cores.entities[core])->absorb(Vector2f(pool.circles.x[bullet], pool.circles.y[bullet]), pool.circles.radius[bullet] * 2.0f);
+	}
+}
+
+// Tests the whole path a bullet covered this frame, so fast bullets can't skip over a target between two frames.
+// Each path is first bounded by a circle for the narrowphase, contacts come out per bullet in the order they happen
+void Projectiles::sweep(const ProjectilePool& pool, const CircleBatch& targets, vector<ProjectileContact>& contacts)
+{
+	CircleBatch paths;
+
+	for (size_t i = 0; i < pool.size(); i++) {
+		const auto halfX = (pool.circles.x[i] - pool.previousX[i]) * 0.5f;
+		const auto halfY = (pool.circles.y[i] - pool.previousY[i]) * 0.5f;
+
+		paths.x.push_back(pool.previousX[i] + halfX);
+		paths.y.push_back(pool.previousY[i] + halfY);
+		paths.radius.push_back(pool.circles.radius[i] + sqrt(halfX * halfX + halfY * halfY));
+	}
+
+	vector<pair<size_t, size_t>> candidates;
+	Narrowphase::query(paths, targets, candidates);
+
+	for (const auto& [bullet, target] : candidates)
+	{
+		const auto time = physics::sweep(Vector2f(pool.previousX[bullet], pool.previousY[bullet]), Vector2f(pool.circles.x[bullet], pool.circles.y[bullet]), pool.circles.radius[bullet],
+			Vector2f(targets.x[target], targets.y[target]), targets.radius[target]);
+
+		if (time >= 0) contacts.push_back({ bullet, target, time });
+	}
+
+	ranges::stable_sort(contacts, [](const ProjectileContact& a, const ProjectileContact& b) {
+		return a.bullet != b.bullet ? a.bullet < b.bullet : a.time < b.time;
+	});
+}
+
+void Projectiles::enemyHit(Enemy* enemy) {
+	auto critHit = physics::rollDice(Player::playerStats.critChance);
+
+	critHit ? enemy->updateHealth(Player::playerStats.bulletDamage * 2) : enemy->updateHealth(Player::playerStats.bulletDamage);
+
+	if (critHit) {
+		StatusEffects::crit(enemy);
+		SoundData::play(Sounds::CRITHIT);
+	}
+	else SoundData::play(Sounds::HIT);
+
+	StatusEffects::flash(enemy, Color::Red);
+}
+
+// Every kind shares one sprite, so each pool goes out as a single textured triangle batch
+void Projectiles::render(RenderList& window)
+{
+	for (size_t kind = 0; kind < pools.size(); kind++) {
+		const auto& pool = pools[kind];
+		if (pool.size() == 0) continue;
+
+		const auto& look = getLook(kindSprites[kind]);
+		const auto rect = look.getTextureRect();
+
+		const Vector2f corners[4] = { { 0.0f, 0.0f }, { float(rect.width), 0.0f }, { float(rect.width), float(rect.height) }, { 0.0f, float(rect.height) } };
+		const Vector2f texCoords[4] = {
+			{ float(rect.left), float(rect.top) },
+			{ float(rect.left + rect.width), float(rect.top) },
+			{ float(rect.left + rect.width), float(rect.top + rect.height) },
+			{ float(rect.left), float(rect.top + rect.height) }
+		};
+
+		VertexArray batch(Triangles, pool.size() * 6);
+
+		for (size_t i = 0; i < pool.size(); i++) {
+			Transform transform;
+			transform.translate(pool.circles.x[i], pool.circles.y[i]).rotate(look.getRotation() + pool.angle[i]).scale(pool.scale[i], pool.scale[i]).translate(-look.getOrigin());
+
+			size_t vertex = i * 6;
+			for (const auto& corner : { 0, 1, 2, 0, 2, 3 })
+				batch[vertex++] = Vertex(transform.transformPoint(corners[corner]), Color::White, texCoords[corner]);
+		}
+
+		RenderStates states;
+		states.texture = look.getTexture();
+		window.draw(batch, states);
+
+		if (!Game::hitboxesVisibility) continue;
+
+		CircleShape shape;
+		shape.setFillColor(Color::Transparent);
+		shape.setOutlineColor(kind == static_cast<size_t>(ProjectileKind::ENEMY) ? Color::Red : Color::Green);
+		shape.setOutlineThickness(1.5f);
+
+		for (size_t i = 0; i < pool.size(); i++) {
+			shape.setRadius(pool.circles.radius[i]);
+			shape.setOrigin(pool.circles.radius[i], pool.circles.radius[i]);
+			shape.setPosition(pool.circles.x[i], pool.circles.y[i]);
+			window.draw(shape);
+		}
+	}
+}
+
+void Projectiles::clear()
+{
+	for (auto& pool : pools) pool.clear();
+}
+
+const size_t Projectiles::getCount(const Faction& faction)
+{
+	if (faction == Faction::ENEMY) return pools[static_cast<size_t>(ProjectileKind::ENEMY)].size();
+
+	size_t count = 0;
+	for (size_t kind = 0; kind < static_cast<size_t>(ProjectileKind::ENEMY); kind++) count += pools[kind].size();
+
+	return count;
+}
+
+ProjectilePool& Projectiles::getPool(const ProjectileKind& kind)
+{
+	return pools[static_cast<size_t>(kind)];
+}
+
+// getSprite copies the whole texture, so each bullet sprite is looked up once
+const Sprite& Projectiles::getLook(const Sprites& sprite)
+{
+	auto look = looks.find(sprite);
+	if (look == looks.end()) look = looks.emplace(sprite, SpriteData::getSprite(sprite).sprite).first;
+
+	return look->second;
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+#ifndef PROJECTILES_H
+#define PROJECTILES_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <cstdint>
+#include "Narrowphase.h"
+#include "SpriteData.h"
+#include "RenderList.h"
+
+using namespace sf;
+using namespace std;
+
+class Entity;
+class Enemy;
+
+enum class Faction : uint8_t {
+	PLAYER,
+	ENEMY
+};
+
+// Player kinds follow BulletType, the kind is taken when a bullet is fired
+enum class ProjectileKind : uint8_t {
+	NORMAL,
+	PIERCING,
+	HOMING,
+	POISON,
+	ENEMY,
+	COUNT
+};
+
+// Enemies a piercing bullet already went through, the oldest entry is overwritten once it's full
+struct ProjectileHits {
+	static const uint8_t capacity = 8;
+
+	array<const Entity*, capacity> entities{};
+	uint8_t count = 0;
+	uint8_t next = 0;
+
+	const bool contains(const Entity* entity) const;
+	void add(const Entity* entity);
+};
+
+// A bullet path that touches a target, time is how far along the path the first touch happens
+struct ProjectileContact {
+	size_t bullet;
+	size_t target;
+	float time;
+};
+
+// Every bullet of one kind, circles double as the narrowphase batch
+struct ProjectilePool {
+	CircleBatch circles;
+	vector<float> previousX;
+	vector<float> previousY;
+	vector<float> directionX;
+	vector<float> directionY;
+	vector<float> angle;
+	vector<float> scale;
+	vector<float> lifeTime;
+	vector<ProjectileHits> hits;
+	vector<Entity*> targets;
+	vector<uint8_t> retargetIn;
+
+	void add(const Vector2f& position, const Vector2f& direction, const float& angle, const float& radius, const float& scale, const float& lifeTime);
+	void remove(const size_t& bullet);
+	void clear();
+	void reserve(const size_t& count);
+	const size_t size() const;
+
+	void rememberPositions();
+};
+
+struct StraightMovement {
+	static void move(ProjectilePool& pool, const float& deltaTime, const float& lifetime);
+};
+
+struct HomingMovement {
+	static void move(ProjectilePool& pool, const float& deltaTime, const float& lifetime);
+	static void retarget(ProjectilePool& pool, const float& threshold);
+};
+
+struct StopOnHit {
+	static const bool pierces = false;
+	static void hit(Enemy* enemy);
+};
+
+struct PierceOnHit {
+	static const bool pierces = true;
+	static void hit(Enemy* enemy);
+};
+
+struct PoisonOnHit {
+	static const bool pierces = false;
+	static void hit(Enemy* enemy);
+};
+
+struct FixedLifetime {
+	static const float initial();
+	static void tick(ProjectilePool& pool, const float& deltaTime);
+};
+
+template<typename Movement, typename OnHit, typename Lifetime>
+struct BulletPolicy {
+	using movement = Movement;
+	using onHit = OnHit;
+	using lifetime = Lifetime;
+};
+
+using NormalPolicy = BulletPolicy<StraightMovement, StopOnHit, FixedLifetime>;
+using PiercingPolicy = BulletPolicy<StraightMovement, PierceOnHit, FixedLifetime>;
+using HomingPolicy = BulletPolicy<HomingMovement, StopOnHit, FixedLifetime>;
+using PoisonPolicy = BulletPolicy<StraightMovement, PoisonOnHit, FixedLifetime>;
+using EnemyPolicy = BulletPolicy<StraightMovement, StopOnHit, FixedLifetime>;
+
+class Projectiles {
+public:
+	static void fire(const Faction& faction, const Vector2f& position, const Vector2f& direction, const float& angle);
+	static void fire(const Faction& faction, span<const Vector2f> positions, span<const Vector2f> directions, span<const float> angles);
+
+	static void update(const float& deltaTime);
+	static void render(RenderList& window);
+	static void clear();
+
+	static const size_t getCount(const Faction& faction);
+private:
+	template<typename Policy>
+	static void updatePlayerBullets(ProjectilePool& pool, const float& deltaTime);
+	template<typename Policy>
+	static void updateEnemyBullets(ProjectilePool& pool, const float& deltaTime);
+
+	template<typename OnHit>
+	static void hitEnemies(ProjectilePool& pool);
+	static void hitPlayer(ProjectilePool& pool);
+	static void absorb(ProjectilePool& pool);
+	static void expire(ProjectilePool& pool);
+	static void bend(ProjectilePool& pool, const float& deltaTime);
+
+	static void sweep(const ProjectilePool& pool, const CircleBatch& targets, vector<ProjectileContact>& contacts);
+
+	static void enemyHit(Enemy* enemy);
+
+	static ProjectilePool& getPool(const ProjectileKind& kind);
+	static const Sprite& getLook(const Sprites& sprite);
+
+	static array<ProjectilePool, static_cast<size_t>(ProjectileKind::COUNT)> pools;
+	static unordered_map<Sprites, Sprite> looks;
+};
+
+#endif
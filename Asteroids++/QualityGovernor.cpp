@@ -0,0 +1,128 @@
+#include "QualityGovernor.h"
+#include "FileMenager.h"
+#include <sstream>
+#include <iomanip>
+
+const size_t averageWindow = 30;
+const int downgradeCooldown = 30;
+const int upgradeHold = 120;
+
+const QualitySettings qualityLevels[] = {
+	{ 1.0f, 1, 1.0f, 0.0f, 1 },
+	{ 0.75f, 2, 0.6f, 600.0f, 1 },
+	{ 0.5f, 3, 0.35f, 400.0f, 2 },
+	{ 0.25f, 4, 0.15f, 250.0f, 3 }
+};
+
+const vector<string> qualityNames = { "full", "reduced", "low", "minimal" };
+
+size_t QualityGovernor::level{ 0 };
+vector<Int64> QualityGovernor::workTimes(averageWindow);
+size_t QualityGovernor::workIndex{ 0 };
+unsigned long long QualityGovernor::frame{ 0 };
+int QualityGovernor::framesSinceChange{ 0 };
+int QualityGovernor::framesUnderBudget{ 0 };
+float QualityGovernor::particleAccumulator{ 0.0f };
+Vector2f QualityGovernor::focus{};
+
+void QualityGovernor::update(const Int64& workTime)
+{
+	workTimes[workIndex] = workTime;
+	workIndex = (workIndex + 1) % averageWindow;
+
+	frame++;
+	framesSinceChange++;
+
+	if (!FileMenager::screenData.quality_governor) {
+		setLevel(0);
+		return;
+	}
+
+	const auto budget = 1000000.0f / max(FileMenager::screenData.framerate, 1);
+	const auto average = getAverage();
+
+	if (average > budget * FileMenager::screenData.frame_budget_high) {
+		framesUnderBudget = 0;
+
+		if (framesSinceChange >= downgradeCooldown && level + 1 < static_cast<size_t>(QualityLevel::COUNT)) setLevel(level + 1);
+		return;
+	}
+
+	// Only win eye candy back after the budget has been comfortably met for a while
+	framesUnderBudget = average < budget * FileMenager::screenData.frame_budget_low ? framesUnderBudget + 1 : 0;
+
+	if (framesUnderBudget >= upgradeHold && level > 0) setLevel(level - 1);
+}
+
+const QualityLevel QualityGovernor::getLevel()
+{
+	return static_cast<QualityLevel>(level);
+}
+
+const QualitySettings& QualityGovernor::getSettings()
+{
+	return qualityLevels[level];
+}
+
+bool QualityGovernor::shouldEmitParticle()
+{
+	particleAccumulator += getSettings().particleRate;
+
+	if (particleAccumulator < 1.0f) return false;
+
+	particleAccumulator -= 1.0f;
+	return true;
+}
+
+bool QualityGovernor::shouldEmitTrail()
+{
+	return frame % getSettings().trailStride == 0;
+}
+
+bool QualityGovernor::isDetailVisible(const Vector2f& position)
+{
+	const auto distance = getSettings().detailDistance;
+
+	if (distance <= 0.0f) return true;
+
+	const auto offset = position - focus;
+
+	return offset.x * offset.x + offset.y * offset.y <= distance * distance;
+}
+
+const size_t QualityGovernor::getWindStreaks(const size_t& total)
+{
+	return static_cast<size_t>(total * getSettings().windStreaks) & ~static_cast<size_t>(1);
+}
+
+void QualityGovernor::setFocus(const Vector2f& position)
+{
+	focus = position;
+}
+
+string QualityGovernor::getSummary()
+{
+	stringstream summary;
+	summary << fixed << setprecision(2)
+		<< "quality " << qualityNames[level]
+		<< "  work " << getAverage() / 1000.0f << " ms";
+
+	return summary.str();
+}
+
+const float QualityGovernor::getAverage()
+{
+	Int64 sum = 0;
+	for (const auto& workTime : workTimes) sum += workTime;
+
+	return static_cast<float>(sum) / averageWindow;
+}
+
+void QualityGovernor::setLevel(const size_t& newLevel)
+{
+	if (newLevel == level) return;
+
+	level = newLevel;
+	framesSinceChange = 0;
+	framesUnderBudget = 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef QUALITYGOVERNOR_H
+#define QUALITYGOVERNOR_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <string>
+
+using namespace sf;
+using namespace std;
+
+enum class QualityLevel {
+	FULL,
+	REDUCED,
+	LOW,
+	MINIMAL,
+	COUNT
+};
+
+struct QualitySettings {
+	float particleRate;
+	int trailStride;
+	float windStreaks;
+	float detailDistance;
+	int aiTickInterval;
+};
+
+class QualityGovernor {
+public:
+	static void update(const Int64& workTime);
+
+	static const QualityLevel getLevel();
+	static const QualitySettings& getSettings();
+
+	static bool shouldEmitParticle();
+	static bool shouldEmitTrail();
+	static bool isDetailVisible(const Vector2f& position);
+	static const size_t getWindStreaks(const size_t& total);
+
+	static void setFocus(const Vector2f& position);
+
+	static string getSummary();
+private:
+	static const float getAverage();
+	static void setLevel(const size_t& newLevel);
+
+	static size_t level;
+	static vector<Int64> workTimes;
+	static size_t workIndex;
+
+	static unsigned long long frame;
+	static int framesSinceChange;
+	static int framesUnderBudget;
+	static float particleAccumulator;
+
+	static Vector2f focus;
+};
+
+#endif
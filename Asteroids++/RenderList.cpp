@@ -0,0 +1,52 @@
+#include "RenderList.h"
+#include <algorithm>
+
+const Font* RenderList::sharedFont = nullptr;
+const Font* RenderList::presentFont = nullptr;
+
+void RenderList::draw(const Text& text, const RenderStates& states)
+{
+	Text copy(text);
+	if (copy.getFont() == sharedFont) copy.setFont(*presentFont);
+
+	commands.push_back({ copy, states, layer });
+}
+
+void RenderList::draw(const Vertex* vertices, const size_t& count, const PrimitiveType& type, const RenderStates& states)
+{
+	VertexArray array(type, count);
+	for (size_t i = 0; i < count; i++) array[i] = vertices[i];
+
+	commands.push_back({ array, states, layer });
+}
+
+void RenderList::shareFont(const Font& font, const Font& newPresentFont)
+{
+	sharedFont = &font;
+	presentFont = &newPresentFont;
+}
+
+void RenderList::setLayer(const RenderLayer& newLayer)
+{
+	layer = newLayer;
+}
+
+void RenderList::keepAlive(const shared_ptr<Texture>& texture)
+{
+	textures.push_back(texture);
+}
+
+void RenderList::clear()
+{
+	commands.clear();
+	textures.clear();
+	layer = RenderLayer::ENTITIES;
+}
+
+void RenderList::present(RenderTarget& target)
+{
+	stable_sort(commands.begin(), commands.end(), [](const RenderCommand& a, const RenderCommand& b) { return a.layer < b.layer; });
+
+	for (const auto& command : commands)
+		visit([&](const auto& drawable) { target.draw(drawable, command.states); }, command.drawing);
+}
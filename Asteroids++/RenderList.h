@@ -0,0 +1,58 @@
+#pragma once
+#ifndef RENDERLIST_H
+#define RENDERLIST_H
+
+#include <SFML/Graphics.hpp>
+#include <variant>
+#include <vector>
+#include <memory>
+
+using namespace sf;
+using namespace std;
+
+enum class RenderLayer {
+	BACKGROUND,
+	PARTICLES,
+	ENTITIES,
+	UI,
+	OVERLAY
+};
+
+using Drawing = variant<Sprite, Text, CircleShape, RectangleShape, VertexArray>;
+
+struct RenderCommand {
+	Drawing drawing;
+	RenderStates states;
+	RenderLayer layer;
+};
+
+// Copies of everything drawn during a frame, so it can be presented after the simulation moved on
+class RenderList {
+public:
+	template <typename T>
+	void draw(const T& drawable, const RenderStates& states = RenderStates::Default)
+	{
+		commands.push_back({ drawable, states, layer });
+	}
+
+	void draw(const Text& text, const RenderStates& states = RenderStates::Default);
+	void draw(const Vertex* vertices, const size_t& count, const PrimitiveType& type, const RenderStates& states = RenderStates::Default);
+
+	// Text loads glyphs into its font while drawing, so presented copies use a font the simulation never touches
+	static void shareFont(const Font& font, const Font& presentFont);
+
+	void setLayer(const RenderLayer& newLayer);
+	void keepAlive(const shared_ptr<Texture>& texture);
+
+	void clear();
+	void present(RenderTarget& target);
+private:
+	vector<RenderCommand> commands;
+	vector<shared_ptr<Texture>> textures;
+	RenderLayer layer = RenderLayer::ENTITIES;
+
+	static const Font* sharedFont;
+	static const Font* presentFont;
+};
+
+#endif
@@ -0,0 +1,103 @@
+#include "RenderThread.h"
+#include "InputLatency.h"
+
+RenderWindow* RenderThread::window = nullptr;
+RenderList RenderThread::frames[2];
+size_t RenderThread::simulated{ 0 };
+size_t RenderThread::presented{ 1 };
+bool RenderThread::pending{ false };
+bool RenderThread::running{ false };
+Int64 RenderThread::displayedAt{ 0 };
+bool RenderThread::displayed{ false };
+thread RenderThread::worker;
+mutex RenderThread::frameMutex;
+condition_variable RenderThread::frameReady;
+condition_variable RenderThread::frameDone;
+
+void RenderThread::start(RenderWindow& renderWindow, const bool& threaded)
+{
+	window = &renderWindow;
+
+	if (!threaded) return;
+
+	// The GL context can only be active on one thread at a time
+	window->setActive(false);
+
+	running = true;
+	worker = thread(renderLoop);
+}
+
+void RenderThread::stop()
+{
+	if (!worker.joinable()) return;
+
+	{
+		lock_guard<mutex> lock(frameMutex);
+		running = false;
+	}
+	frameReady.notify_one();
+
+	worker.join();
+
+	window->setActive(true);
+}
+
+RenderList& RenderThread::getFrame()
+{
+	return frames[simulated];
+}
+
+void RenderThread::submit()
+{
+	if (!worker.joinable()) {
+		present(frames[simulated]);
+		InputLatency::frameDisplayed(InputLatency::now());
+		return;
+	}
+
+	unique_lock<mutex> lock(frameMutex);
+	frameDone.wait(lock, []() { return !pending; });
+
+	if (displayed) InputLatency::frameDisplayed(displayedAt);
+	displayed = false;
+
+	presented = simulated;
+	simulated = 1 - simulated;
+	pending = true;
+
+	lock.unlock();
+	frameReady.notify_one();
+}
+
+void RenderThread::renderLoop()
+{
+	window->setActive(true);
+
+	while (true) {
+		unique_lock<mutex> lock(frameMutex);
+		frameReady.wait(lock, []() { return pending || !running; });
+
+		if (!running) break;
+
+		lock.unlock();
+		present(frames[presented]);
+		const auto time = InputLatency::now();
+		lock.lock();
+
+		displayedAt = time;
+		displayed = true;
+		pending = false;
+		frameDone.notify_one();
+	}
+
+	window->setActive(false);
+}
+
+void RenderThread::present(RenderList& frame)
+{
+	window->clear();
+	frame.present(*window);
+	window->display();
+
+	frame.clear();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef RENDERTHREAD_H
+#define RENDERTHREAD_H
+
+#include <SFML/Graphics.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "RenderList.h"
+
+using namespace sf;
+using namespace std;
+
+class RenderThread {
+public:
+	static void start(RenderWindow& window, const bool& threaded);
+	static void stop();
+
+	// List the simulation draws the current frame into
+	static RenderList& getFrame();
+
+	// Hands the frame over, waits only while the previous one is still being drawn
+	static void submit();
+private:
+	static void renderLoop();
+	static void present(RenderList& frame);
+
+	static RenderWindow* window;
+	static RenderList frames[2];
+	static size_t simulated;
+	static size_t presented;
+	static bool pending;
+	static bool running;
+
+	// When the render thread's last display() returned, handed to InputLatency on the next submit
+	static Int64 displayedAt;
+	static bool displayed;
+
+	static thread worker;
+	static mutex frameMutex;
+	static condition_variable frameReady;
+	static condition_variable frameDone;
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "ResourceCache.h"
+#include "FileMenager.h"
+
+unordered_map<string, CachedTexture> ResourceCache::textures;
+mutex ResourceCache::cacheMutex;
+size_t ResourceCache::usedBytes{ 0 };
+unsigned long long ResourceCache::useCounter{ 0 };
+
+shared_ptr<Texture> ResourceCache::getTexture(const string& path)
+{
+	unique_lock<mutex> lock(cacheMutex);
+
+	auto& cached = textures[path];
+	cached.lastUsed = ++useCounter;
+
+	if (cached.texture) return cached.texture;
+
+	auto pending = move(cached.pending);
+
+	// Waiting and decoding happen unlocked so one slow image doesn't hold up every other lookup
+	lock.unlock();
+
+	// Preloaded images were decoded on a worker thread, the GPU upload has to happen here
+	shared_ptr<Image> image = pending.valid() ? pending.get() : nullptr;
+
+	if (!image) {
+		image = make_shared<Image>();
+		if (!image->loadFromFile(path)) image = nullptr;
+	}
+
+	lock.lock();
+
+	auto& entry = textures[path];
+	if (entry.texture) return entry.texture;
+
+	if (!image) {
+		cerr << "Error: Cannot load texture " << path << endl;
+		textures.erase(path);
+		return make_shared<Texture>();
+	}
+
+	upload(entry, *image);
+	evict(path);
+
+	return entry.texture;
+}
+
+void ResourceCache::preloadTexture(const string& path)
+{
+	lock_guard<mutex> lock(cacheMutex);
+
+	if (textures.contains(path)) return;
+
+	auto& entry = textures[path];
+	entry.lastUsed = ++useCounter;
+	entry.pending = async(launch::async, [path]() {
+		auto image = make_shared<Image>();
+
+		return image->loadFromFile(path) ? image : nullptr;
+	});
+}
+
+void ResourceCache::upload(CachedTexture& entry, const Image& image)
+{
+	entry.texture = make_shared<Texture>();
+
+	if (!entry.texture->loadFromImage(image)) {
+		cerr << "Error: Cannot upload texture" << endl;
+		return;
+	}
+
+	entry.bytes = static_cast<size_t>(image.getSize().x) * image.getSize().y * 4;
+	usedBytes += entry.bytes;
+}
+
+void ResourceCache::evict(const string& keep)
+{
+	while (usedBytes > getBudget()) {
+		auto oldest = textures.end();
+
+		// Textures still referenced by a page or still being decoded can't go
+		for (auto it = textures.begin(); it != textures.end(); ++it) {
+			if (it->first == keep || !it->second.texture || it->second.texture.use_count() > 1) continue;
+			if (oldest == textures.end() || it->second.lastUsed < oldest->second.lastUsed) oldest = it;
+		}
+
+		if (oldest == textures.end()) return;
+
+		usedBytes -= oldest->second.bytes;
+		textures.erase(oldest);
+	}
+}
+
+const size_t ResourceCache::getBudget()
+{
+	return static_cast<size_t>(FileMenager::screenData.texture_cache_budget) << 20;
+}
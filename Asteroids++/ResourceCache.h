@@ -0,0 +1,39 @@
+#pragma once
+#ifndef RESOURCECACHE_H
+#define RESOURCECACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <memory>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+using namespace sf;
+using namespace std;
+
+struct CachedTexture {
+	shared_ptr<Texture> texture;
+	future<shared_ptr<Image>> pending;
+
+	size_t bytes = 0;
+	unsigned long long lastUsed = 0;
+};
+
+class ResourceCache {
+public:
+	static shared_ptr<Texture> getTexture(const string& path);
+	static void preloadTexture(const string& path);
+private:
+	static void upload(CachedTexture& entry, const Image& image);
+	static void evict(const string& keep);
+	static const size_t getBudget();
+
+	static unordered_map<string, CachedTexture> textures;
+	static mutex cacheMutex;
+
+	static size_t usedBytes;
+	static unsigned long long useCounter;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "Score.h"
 #include "WindowBox.h"
+#include "CommandBuffer.h"
 
 size_t Score::score{ 0 };
 TextField Score::scoreText{ 24 };
@@ -42,6 +43,8 @@ void Score::clear() {
 
 void Score::addScore(const size_t& value)
 {
+	if (const auto buffer = CommandBuffer::getRecording()) return buffer->record([value]() { addScore(value); });
+
 	score += (value * (Player::playerStats.scoreTimes2.isEffectActive() ? 2 : Player::playerStats.scoreTimes5.isEffectActive() ? 5 : 1));
 }
 
@@ -0,0 +1,68 @@
+#include "Shockwaves.h"
+#include "Game.h"
+#include "Enemy.h"
+#include "Kinematics.h"
+#include "Physics.h"
+
+vector<Blast> Shockwaves::pending;
+
+vector<Vector2f> Shockwaves::impulses;
+vector<float> Shockwaves::damages;
+vector<size_t> Shockwaves::touched;
+
+void Shockwaves::emit(const Vector2f& position, const float& radius, const float& strength, const float& damage)
+{
+	pending.push_back({ position, radius, strength, damage });
+}
+
+void Shockwaves::apply()
+{
+	if (pending.empty()) return;
+
+	const auto& enemies = Game::getEnemyBatch();
+	const auto& grid = Game::getEnemyGrid();
+
+	impulses.assign(enemies.size(), Vector2f());
+	damages.assign(enemies.size(), 0.0f);
+	touched.clear();
+
+	vector<size_t> found;
+
+	// Overlapping blasts add up first, so every enemy gets one impulse and one hit however many went off around it
+	for (const auto& blast : pending) {
+		found.clear();
+		grid.queryRadius(blast.position, blast.radius, found);
+
+		for (const auto i : found) {
+			const auto enemy = enemies.entities[i];
+			if (!enemy->isActive()) continue;
+
+			const auto offset = Vector2f(enemies.x[i], enemies.y[i]) - blast.position;
+			const auto distance = physics::length(offset);
+			const auto falloff = 1.0f - distance / blast.radius;
+
+			if (falloff <= 0.0f) continue;
+
+			if (impulses[i] == Vector2f() && damages[i] == 0.0f) touched.push_back(i);
+
+			if (distance > 0.0f) impulses[i] += offset / distance * blast.strength * falloff * FileMenager::enemiesData.asteroid_size / max(enemy->size, 1.0f);
+			damages[i] += blast.damage * falloff;
+		}
+	}
+
+	pending.clear();
+
+	for (const auto i : touched) {
+		auto enemy = static_cast<Enemy*>(enemies.entities[i]);
+
+		if (enemy->body != Kinematics::none) Kinematics::applyImpulse(enemy->body, impulses[i]);
+
+		// Anything this kills explodes on its own update, its blast goes off next frame
+		if (damages[i] > 0.0f) enemy->updateHealth(damages[i]);
+	}
+}
+
+void Shockwaves::clear()
+{
+	pending.clear();
+}
@@ -0,0 +1,34 @@
+#pragma once
+#ifndef SHOCKWAVES_H
+#define SHOCKWAVES_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Strength is the push given to an average sized asteroid at the center, both push and damage fade out linearly to the edge
+struct Blast {
+	Vector2f position;
+	float radius;
+	float strength;
+	float damage;
+};
+
+// Explosions queued during a frame and resolved together on the next one, once the enemy grid is rebuilt
+class Shockwaves {
+public:
+	static void emit(const Vector2f& position, const float& radius, const float& strength, const float& damage);
+
+	static void apply();
+	static void clear();
+private:
+	static vector<Blast> pending;
+
+	static vector<Vector2f> impulses;
+	static vector<float> damages;
+	static vector<size_t> touched;
+};
+
+#endif
@@ -7,6 +7,8 @@ SingleAsteroid::SingleAsteroid(): Enemy(100.0f + 100.0f * floor(Score::getScore(
 {
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 	drawHitboxes();
+
+	body = Kinematics::add(this, EdgeMode::BOUNCE, FileMenager::enemiesData.asteroid_spin);
 }
 
 SingleAsteroid::SingleAsteroid(Vector2f p, Vector2f d): Enemy(100.0f + 100.0f * floor(Score::getScore() / FileMenager::screenData.game_next_level_spike), physics::getRandomFloatValue(FileMenager::enemiesData.asteroid_speed) + 50.0f, getSprite(Sprites::SINGLE_ASTEROID))
@@ -18,9 +20,11 @@ SingleAsteroid::SingleAsteroid(Vector2f p, Vector2f d): Enemy(100.0f + 100.0f *
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 
 	drawHitboxes(radius / 2);
+
+	body = Kinematics::add(this, EdgeMode::BOUNCE, FileMenager::enemiesData.asteroid_spin);
 }
 
-void SingleAsteroid::render(RenderWindow& window)
+void SingleAsteroid::render(RenderList& window)
 {
 	Enemy::render(window);
 }
@@ -31,32 +35,10 @@ void SingleAsteroid::update(float deltaTime)
 
 	if (Game::freeze.isEffectActive()) return;
 
-	angle += FileMenager::enemiesData.asteroid_spin * deltaTime;
-	position += Vector2f(direction.x * speed * deltaTime, direction.y * speed * deltaTime);
-
-	if (position.x < radius) {
-		direction.x = abs(direction.x);
-	}
-	else if (position.x > WindowBox::getVideoMode().width - radius) {
-		direction.x = -abs(direction.x);
-	}
-
-	if (position.y < radius) {
-		direction.y = abs(direction.y);
-	}
-	else if (position.y > WindowBox::getVideoMode().height - radius) {
-		direction.y = -abs(direction.y);
-	}
-
 	setSpriteFullCycle(deltaTime);
-
-	collisionDetection();
 }
 
-void SingleAsteroid::collisionDetection()
-{
-	bounceCollisionDetection();
-}
+void SingleAsteroid::collisionDetection() {}
 
 void SingleAsteroid::destroy()
 {
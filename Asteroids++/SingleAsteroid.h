@@ -14,7 +14,7 @@ public:
 	SingleAsteroid();
 	SingleAsteroid(Vector2f position, Vector2f direction);
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void destroy() override;
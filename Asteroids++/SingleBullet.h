@@ -1,18 +0,0 @@
-#pragma once
-#ifndef SINGLEBULLET_H
-#define SINGLEBULLET_H
-
-#include <SFML/Graphics.hpp>
-#include "Entity.h"
-#include "Bullet.h"
-#include "Score.h"
-
-class SingleBullet : public Bullet {
-public:
-	SingleBullet(Vector2f position, Vector2f direction, float& angle);
-
-	void update(float deltaTime) override;
-	const EntityType getEntityType() override;
-};
-
-#endif
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "SoundData.h"
 #include "FileMenager.h"
+#include "CommandBuffer.h"
 
 unordered_map <Sounds, Sound> SoundData::sounds;
 
@@ -63,6 +64,8 @@ void SoundData::loadAllSounds()
 
 void SoundData::play(Sounds name)
 {
+    if (const auto buffer = CommandBuffer::getRecording()) return buffer->record([name]() { play(name); });
+
     sounds[name].setVolume(100);
 
     sounds[name].play();
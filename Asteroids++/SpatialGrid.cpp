@@ -0,0 +1,134 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+const size_t SpatialGrid::none = static_cast<size_t>(-1);
+
+void SpatialGrid::build(const vector<float>& x, const vector<float>& y, const float& size)
+{
+	pointsX = &x;
+	pointsY = &y;
+	cellSize = size;
+
+	const auto count = x.size();
+
+	if (count == 0) {
+		columns = rows = 0;
+		cellStart.assign(1, 0);
+		items.clear();
+		return;
+	}
+
+	const auto [minX, maxX] = minmax_element(x.begin(), x.end());
+	const auto [minY, maxY] = minmax_element(y.begin(), y.end());
+
+	left = *minX;
+	top = *minY;
+	columns = int((*maxX - left) / cellSize) + 1;
+	rows = int((*maxY - top) / cellSize) + 1;
+
+	cellStart.assign(size_t(columns) * rows + 1, 0);
+	items.resize(count);
+
+	vector<size_t> cells(count);
+
+	for (size_t i = 0; i < count; i++) {
+		cells[i] = size_t(getRow(y[i])) * columns + getColumn(x[i]);
+		cellStart[cells[i] + 1]++;
+	}
+
+	for (size_t cell = 1; cell < cellStart.size(); cell++) cellStart[cell] += cellStart[cell - 1];
+
+	vector<size_t> next(cellStart.begin(), cellStart.end() - 1);
+	for (size_t i = 0; i < count; i++) items[next[cells[i]]++] = i;
+}
+
+// Stops once limit points were found, which ones depends on the cell order rather than the distance
+void SpatialGrid::queryRadius(const Vector2f& position, const float& radius, vector<size_t>& found, const size_t& limit) const
+{
+	if (columns == 0) return;
+
+	const auto maxSize = limit == none ? none : found.size() + limit;
+
+	const auto& x = *pointsX;
+	const auto& y = *pointsY;
+	const auto radiusSquared = radius * radius;
+
+	const auto firstColumn = getColumn(position.x - radius), lastColumn = getColumn(position.x + radius);
+	const auto firstRow = getRow(position.y - radius), lastRow = getRow(position.y + radius);
+
+	for (int row = firstRow; row <= lastRow; row++) {
+		for (int column = firstColumn; column <= lastColumn; column++) {
+			const auto cell = size_t(row) * columns + column;
+
+			for (auto item = cellStart[cell]; item < cellStart[cell + 1]; item++) {
+				const auto i = items[item];
+				const auto dx = x[i] - position.x;
+				const auto dy = y[i] - position.y;
+
+				if (dx * dx + dy * dy > radiusSquared) continue;
+
+				found.push_back(i);
+				if (found.size() == maxSize) return;
+			}
+		}
+	}
+}
+
+// Searches rings of cells outwards and stops once no closer point can be left in the next ring
+const size_t SpatialGrid::nearest(const Vector2f& position, const float& radius) const
+{
+	if (columns == 0) return none;
+
+	const auto& x = *pointsX;
+	const auto& y = *pointsY;
+
+	const auto centerColumn = int(floor((position.x - left) / cellSize));
+	const auto centerRow = int(floor((position.y - top) / cellSize));
+	const auto rings = int(ceil(radius / cellSize)) + 1;
+
+	auto best = none;
+	auto bestDistance = radius * radius;
+
+	for (int ring = 0; ring <= rings; ring++) {
+		const auto reach = (ring - 1) * cellSize;
+		if (ring > 0 && reach > 0 && reach * reach >= bestDistance) break;
+
+		for (int row = centerRow - ring; row <= centerRow + ring; row++) {
+			if (row < 0 || row >= rows) continue;
+
+			const bool edge = row == centerRow - ring || row == centerRow + ring;
+			const int step = edge || ring == 0 ? 1 : ring * 2;
+
+			for (int column = centerColumn - ring; column <= centerColumn + ring; column += step) {
+				if (column < 0 || column >= columns) continue;
+
+				const auto cell = size_t(row) * columns + column;
+
+				for (auto item = cellStart[cell]; item < cellStart[cell + 1]; item++) {
+					const auto i = items[item];
+					const auto dx = x[i] - position.x;
+					const auto dy = y[i] - position.y;
+					const auto distance = dx * dx + dy * dy;
+
+					if (distance >= bestDistance) continue;
+
+					bestDistance = distance;
+					best = i;
+				}
+			}
+		}
+	}
+
+	return best;
+}
+
+const int SpatialGrid::getColumn(const float& x) const
+{
+	return clamp(int(floor((x - left) / cellSize)), 0, columns - 1);
+}
+
+const int SpatialGrid::getRow(const float& y) const
+{
+	return clamp(int(floor((y - top) / cellSize)), 0, rows - 1);
+}
\ No newline at end of file
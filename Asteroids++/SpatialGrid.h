@@ -0,0 +1,37 @@
+#pragma once
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Uniform grid over a set of points, rebuilt from scratch each time with a counting sort into flat cell ranges
+class SpatialGrid {
+public:
+	static const size_t none;
+
+	void build(const vector<float>& x, const vector<float>& y, const float& cellSize);
+
+	void queryRadius(const Vector2f& position, const float& radius, vector<size_t>& found, const size_t& limit = none) const;
+	const size_t nearest(const Vector2f& position, const float& radius) const;
+private:
+	const int getColumn(const float& x) const;
+	const int getRow(const float& y) const;
+
+	const vector<float>* pointsX = nullptr;
+	const vector<float>* pointsY = nullptr;
+
+	float cellSize = 1.0f;
+	float left = 0.0f;
+	float top = 0.0f;
+	int columns = 0;
+	int rows = 0;
+
+	vector<size_t> cellStart;
+	vector<size_t> items;
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include "StatusEffects.h"
+#include "Enemy.h"
+#include <algorithm>
+
+// The crit text is fully visible for most of its time and fades over the last part
+const float critFadeTime = 0.4f;
+
+vector<StatusEntry> StatusEffects::entries;
+unordered_map<const Enemy*, size_t> StatusEffects::indices;
+
+void StatusEffects::flash(Enemy* enemy, const Color& tint)
+{
+	auto& entry = getEntry(enemy);
+
+	entry.tint = tint;
+	entry.tintLeft = FileMenager::timingsData.default_hit_effect_time;
+	enemy->spriteInfo.sprite.setColor(tint);
+}
+
+void StatusEffects::crit(Enemy* enemy)
+{
+	getEntry(enemy).critLeft = FileMenager::timingsData.default_crit_timer;
+	enemy->showCrit = true;
+}
+
+// A new stack beyond the limit replaces the one closest to running out
+void StatusEffects::poison(Enemy* enemy)
+{
+	auto& entry = getEntry(enemy);
+
+	const PoisonStack stack{ uint8_t(FileMenager::playerData.player_bullet_poison_amount), 0.0f };
+
+	if (entry.stacks < StatusEntry::maxStacks) entry.poison[entry.stacks++] = stack;
+	else *min_element(entry.poison.begin(), entry.poison.end(), [](const auto& a, const auto& b) { return a.dosesLeft < b.dosesLeft; }) = stack;
+
+	enemy->poisoned = true;
+}
+
+void StatusEffects::update(const float& deltaTime)
+{
+	for (size_t i = entries.size(); i-- > 0;) {
+		auto& entry = entries[i];
+
+		// Enemies are switched off rather than deleted, so a dead one is still safe to look at here
+		if (!entry.enemy->isActive()) {
+			remove(i);
+			continue;
+		}
+
+		updatePoison(entry, deltaTime);
+		updateTint(entry, deltaTime);
+		updateCrit(entry, deltaTime);
+
+		if (entry.stacks == 0 && entry.tintLeft <= 0.0f && entry.critLeft <= 0.0f) remove(i);
+	}
+}
+
+void StatusEffects::clear()
+{
+	entries.clear();
+	indices.clear();
+}
+
+StatusEntry& StatusEffects::getEntry(Enemy* enemy)
+{
+	const auto [found, added] = indices.emplace(enemy, entries.size());
+
+	if (added) entries.push_back({ enemy });
+
+	return entries[found->second];
+}
+
+void StatusEffects::remove(const size_t& entry)
+{
+	const auto last = entries.size() - 1;
+
+	indices.erase(entries[entry].enemy);
+
+	if (entry != last) {
+		entries[entry] = entries[last];
+		indices[entries[entry].enemy] = entry;
+	}
+
+	entries.pop_back();
+}
+
+void StatusEffects::updatePoison(StatusEntry& entry, const float& deltaTime)
+{
+	if (entry.stacks == 0) return;
+
+	const auto enemy = entry.enemy;
+	const auto doseTime = FileMenager::timingsData.default_poison_dose_time / 1000.0f;
+
+	for (uint8_t i = 0; i < entry.stacks;) {
+		auto& stack = entry.poison[i];
+
+		stack.untilDose -= deltaTime;
+
+		if (stack.untilDose <= 0.0f && enemy->getHealth() > 0) {
+			enemy->updateHealth(enemy->getMaxHealth() * FileMenager::playerData.player_bullet_poison_damage);
+			flash(enemy, Color::Magenta);
+
+			stack.dosesLeft--;
+			stack.untilDose += doseTime;
+		}
+
+		if (stack.dosesLeft == 0 || enemy->getHealth() <= 0) {
+			stack = entry.poison[--entry.stacks];
+			continue;
+		}
+
+		i++;
+	}
+
+	enemy->poisoned = entry.stacks > 0;
+}
+
+void StatusEffects::updateTint(StatusEntry& entry, const float& deltaTime)
+{
+	if (entry.tintLeft <= 0.0f) return;
+
+	entry.tintLeft = max(entry.tintLeft - deltaTime, 0.0f);
+
+	const auto progress = 1.0f - entry.tintLeft / FileMenager::timingsData.default_hit_effect_time;
+	const auto& start = entry.tint;
+	const auto lerp = [&](const Uint8& from, const Uint8& to) { return static_cast<Uint8>(from + progress * (to - from)); };
+
+	entry.enemy->spriteInfo.sprite.setColor(Color(lerp(start.r, 255), lerp(start.g, 255), lerp(start.b, 255), lerp(start.a, 255)));
+}
+
+void StatusEffects::updateCrit(StatusEntry& entry, const float& deltaTime)
+{
+	if (entry.critLeft <= 0.0f) return;
+
+	const auto enemy = entry.enemy;
+	auto& crit = enemy->crit;
+
+	entry.critLeft -= deltaTime;
+	enemy->showCrit = entry.critLeft > 0.0f;
+
+	crit.setTextPosition(Vector2f(enemy->position.x - crit.getText().getLocalBounds().width / 2, enemy->position.y - crit.getText().getLocalBounds().height));
+
+	Color color = crit.getText().getFillColor();
+	color.a = static_cast<Uint8>(255.0f * clamp(entry.critLeft / critFadeTime, 0.0f, 1.0f));
+
+	crit.setColorText(color);
+}
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef STATUSEFFECTS_H
+#define STATUSEFFECTS_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <cstdint>
+
+using namespace sf;
+using namespace std;
+
+class Enemy;
+
+struct PoisonStack {
+	uint8_t dosesLeft = 0;
+	float untilDose = 0.0f;
+};
+
+// Everything currently running on one enemy, the entry goes away once all of it has worn off
+struct StatusEntry {
+	static const uint8_t maxStacks = 4;
+
+	Enemy* enemy;
+	array<PoisonStack, maxStacks> poison{};
+	uint8_t stacks = 0;
+
+	Color tint = Color::White;
+	float tintLeft = 0.0f;
+	float critLeft = 0.0f;
+};
+
+// Hit flashes, crit popups and poison on the game clock, only enemies with something active are visited
+class StatusEffects {
+public:
+	static void flash(Enemy* enemy, const Color& tint);
+	static void crit(Enemy* enemy);
+	static void poison(Enemy* enemy);
+
+	static void update(const float& deltaTime);
+	static void clear();
+private:
+	static StatusEntry& getEntry(Enemy* enemy);
+	static void remove(const size_t& entry);
+
+	static void updatePoison(StatusEntry& entry, const float& deltaTime);
+	static void updateTint(StatusEntry& entry, const float& deltaTime);
+	static void updateCrit(StatusEntry& entry, const float& deltaTime);
+
+	static vector<StatusEntry> entries;
+	static unordered_map<const Enemy*, size_t> indices;
+};
+
+#endif
@@ -1,23 +1,55 @@
 #include "Strauner.h"
 #include "WindowBox.h"
-#include "EnemyBullet.h"
+#include "Patterns.h"
 #include "Pickup.h"
+#include "QualityGovernor.h"
+#include "FlowField.h"
 
 Strauner::Strauner() : Enemy(2000.0f + 20.0f * floor(Score::getScore() / FileMenager::screenData.game_next_level_spike), physics::getRandomFloatValue(FileMenager::enemiesData.asteroid_speed), getSprite(Sprites::STRAUNER)),
-changePosition(5.0f, false),
-shoot(0.0f, false),
-hue(0.0f)
+hue(0.0f),
+directionToPlayer(direction),
+moveDirection(direction),
+slightlyOffDirection(direction),
+aimAngle(angle),
+bulletAngle(angle)
 {
 	scaleSprite(spriteInfo.sprite, spriteInfo.spriteSize, size);
 
 	drawHitboxes();
+
+	// Too heavy for black holes to pull in
+	setLayer(LAYER_HEAVY_ENEMY);
+
+	Behaviours::start(this, attack());
 }
 
-void Strauner::render(RenderWindow& window)
+void Strauner::render(RenderList& window)
 {
 	Enemy::render(window);
 }
 
+void Strauner::think()
+{
+	if (Game::freeze.isEffectActive() || !AIScheduler::shouldThink(clock)) return;
+
+	const auto& blackboard = AIScheduler::getBlackboard();
+
+	if (blackboard.hasPlayer) directionToPlayer = physics::normalize(blackboard.playerPosition - position);
+
+	const auto flow = FlowField::sample(position);
+	moveDirection = flow == Vector2f() ? directionToPlayer : flow;
+
+	aimAngle = atan2(directionToPlayer.y, directionToPlayer.x) * 180 / physics::getPI();
+
+	float angleOffset = clock.getRandom(0.0f, 360.0f) * physics::getPI() / 180.0f;
+	float cosAngle = cos(angleOffset);
+	float sinAngle = sin(angleOffset);
+	slightlyOffDirection = Vector2f(directionToPlayer.x * cosAngle - directionToPlayer.y * sinAngle,
+		directionToPlayer.x * sinAngle + directionToPlayer.y * cosAngle);
+
+	bulletAngle = atan2(slightlyOffDirection.y, slightlyOffDirection.x) * 180 / physics::getPI();
+}
+
 void Strauner::update(float deltaTime)
 {
 	Enemy::update(deltaTime);
@@ -63,55 +95,36 @@ void Strauner::update(float deltaTime)
 
 	Color rainbowColor(static_cast<sf::Uint8>((r + m) * 255), static_cast<sf::Uint8>((g + m) * 255), static_cast<sf::Uint8>((b + m) * 255));
 
-	Game::addParticle(new Particle(position, angle, spriteInfo.spriteType, rainbowColor, 0.5f));
+	if (QualityGovernor::shouldEmitTrail()) Game::addParticle(new Particle(position, angle, spriteInfo.spriteType, rainbowColor, 0.5f));
 
     if (Game::freeze.isEffectActive()) return;
 
-    changePosition.updateEffectDuration(deltaTime);
-	shoot.updateEffectDuration(deltaTime);
-
-	angle += FileMenager::enemiesData.asteroid_spin * deltaTime;
-
-	Entity* player = Game::getEntities().back();
-	Vector2f playerPosition = player->position;
-
-	Vector2f directionToPlayer = physics::normalize(playerPosition - position);
-	angle = atan2(directionToPlayer.y, directionToPlayer.x) * 180 / physics::getPI();
+	angle = AIScheduler::turnTowards(angle, aimAngle, deltaTime);
 
+	if (getHealth() > 2000.0f / 2) position += moveDirection * speed * deltaTime;
 
-	if (getHealth() > 2000.0f / 2) {
-
-	float angleOffset = rand() * physics::getPI() / 180.0f;
-	float cosAngle = cos(angleOffset);
-	float sinAngle = sin(angleOffset);
-	Vector2f slightlyOffDirection = Vector2f(directionToPlayer.x * cosAngle - directionToPlayer.y * sinAngle,
-		directionToPlayer.x * sinAngle + directionToPlayer.y * cosAngle);
-
-	position += directionToPlayer * speed * deltaTime;
-
-	float bulletAngle = atan2(slightlyOffDirection.y, slightlyOffDirection.x) * 180 / physics::getPI();
+    setSpriteFullCycle(deltaTime);
+}
 
-		if (!shoot.isEffectActive()) {
-			shoot.startEffect(0.7f);
+// Aimed shots while healthy, once below half health it stops chasing and sprays bursts instead
+BehaviourTask Strauner::attack()
+{
+	size_t volley = 0;
 
-			Game::addEntity(new EnemyBullet(position, slightlyOffDirection, bulletAngle, Sprites::ENEMY_BULLET));
+	for (;;) {
+		if (getHealth() > 2000.0f / 2) {
+			Patterns::emit(Faction::ENEMY, Patterns::get("straunerShot"), position, bulletAngle, volley++);
 			SoundData::play(Sounds::ALIEN_SHOOT1);
+
+			co_await behaviour::seconds(0.7f);
+			continue;
 		}
-	}
-	else {
-		if (!shoot.isEffectActive()) {
 
-			shoot.startEffect(1.4f);
+		Patterns::emit(Faction::ENEMY, Patterns::get("straunerBurst"), position, aimAngle, volley++);
+		SoundData::play(Sounds::ALIEN_SHOOT1);
 
-			for (size_t i = 0; i < 7; i++)
-			{
-				Game::addEntity(new EnemyBullet(position + physics::getRandomDirection() * 30.0f, directionToPlayer, angle, Sprites::ENEMY_BULLET));
-			}
-			SoundData::play(Sounds::ALIEN_SHOOT1);
-		}
+		co_await behaviour::seconds(1.4f);
 	}
-
-    setSpriteFullCycle(deltaTime);
 }
 
 void Strauner::collisionDetection() {}
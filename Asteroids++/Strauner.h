@@ -3,6 +3,8 @@
 #define STRAUNER_H
 
 #include "Enemy.h"
+#include "AIScheduler.h"
+#include "Behaviours.h"
 #include "Entity.h"
 
 using namespace sf;
@@ -13,18 +15,25 @@ class Strauner : public Enemy
 public:
 	Strauner();
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
+	void think() override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void destroy() override;
 
 private:
+	BehaviourTask attack();
+
 	Vector2f newPosition;
 	Vector2f target;
-	Effect changePosition;
-	Effect shoot;
 
 	float hue;
+	Vector2f directionToPlayer;
+	Vector2f moveDirection;
+	Vector2f slightlyOffDirection;
+	float aimAngle;
+	float bulletAngle;
+	AIClock clock;
 };
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "WindowBox.h"
 
 Font TextField::font{};
+Font TextField::presentFont{};
 
 TextField::TextField(int size) : size(size) {
 
@@ -53,13 +54,15 @@ void TextField::setColorText(const Color& color) {
 
 void TextField::loadFont()
 {
-	if (!font.loadFromFile("./assets/font.otf")) {
+	if (!font.loadFromFile("./assets/font.otf") || !presentFont.loadFromFile("./assets/font.otf")) {
 		cout << "Error: Could not open file: font.otf\n";
 		return;
 	}
+
+	RenderList::shareFont(font, presentFont);
 }
 
-void TextField::draw(RenderWindow& window) const
+void TextField::draw(RenderList& window) const
 {
 	window.draw(text);
 }
\ No newline at end of file
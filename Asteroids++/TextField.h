@@ -5,6 +5,7 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <iostream>
+#include "RenderList.h"
 
 using namespace sf;
 using namespace std;
@@ -30,11 +31,12 @@ public:
 
 	static void loadFont();
 
-	void draw(RenderWindow& window) const;
+	void draw(RenderList& window) const;
 
 private:
 	Text text;
 	static Font font;
+	static Font presentFont;
 	int size;
 };
 #endif
\ No newline at end of file
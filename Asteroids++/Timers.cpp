@@ -0,0 +1,99 @@
+#include "Timers.h"
+#include "Game.h"
+#include <algorithm>
+#include <cmath>
+
+array<TimerWheel, static_cast<size_t>(GameClock::COUNT)> Timers::wheels;
+unordered_set<uint32_t> Timers::pending;
+uint32_t Timers::nextId = 1;
+
+void TimerWheel::schedule(const uint32_t& id, const float& delay, const function<void()>& callback)
+{
+	// Anything further out than the top level can reach is clamped to its last slot
+	const uint64_t horizon = (uint64_t(1) << (levelBits * levelCount)) - 1;
+	const auto ticks = clamp<uint64_t>(uint64_t(ceil((max(delay, 0.0f) + remainder) / tickLength)), 1, horizon);
+
+	insert({ id, tick + ticks, callback });
+}
+
+void TimerWheel::insert(Timer&& timer)
+{
+	uint8_t level = 0;
+	while (level + 1 < levelCount && (timer.deadline ^ tick) >> (levelBits * (level + 1))) level++;
+
+	const auto slot = (timer.deadline >> (levelBits * level)) & (slotCount - 1);
+	levels[level][slot].push_back(move(timer));
+}
+
+void TimerWheel::cascade(const uint8_t& level)
+{
+	auto& slot = levels[level][(tick >> (levelBits * level)) & (slotCount - 1)];
+
+	auto timers = move(slot);
+	slot.clear();
+
+	for (auto& timer : timers) insert(move(timer));
+}
+
+// Callbacks may schedule new timers, those always land at least one tick ahead
+void TimerWheel::advance(const float& deltaTime, unordered_set<uint32_t>& pending)
+{
+	remainder += deltaTime;
+
+	while (remainder >= tickLength) {
+		remainder -= tickLength;
+		tick++;
+
+		for (uint8_t level = levelCount - 1; level > 0; level--)
+			if ((tick & ((uint64_t(1) << (levelBits * level)) - 1)) == 0) cascade(level);
+
+		auto& slot = levels[0][tick & (slotCount - 1)];
+
+		auto due = move(slot);
+		slot.clear();
+
+		for (auto& timer : due)
+			if (pending.erase(timer.id)) timer.callback();
+	}
+}
+
+const double TimerWheel::now() const
+{
+	return double(tick) * tickLength + remainder;
+}
+
+const uint32_t Timers::after(const float& delay, const function<void()>& callback, const GameClock& clock)
+{
+	const auto id = nextId++;
+
+	pending.insert(id);
+	wheels[static_cast<size_t>(clock)].schedule(id, delay, callback);
+
+	return id;
+}
+
+// The entry stays in its slot and is skipped when it comes up
+void Timers::cancel(const uint32_t& id)
+{
+	pending.erase(id);
+}
+
+const bool Timers::isPending(const uint32_t& id)
+{
+	return pending.contains(id);
+}
+
+const double Timers::now(const GameClock& clock)
+{
+	return wheels[static_cast<size_t>(clock)].now();
+}
+
+void Timers::update(const float& deltaTime)
+{
+	const auto state = Game::getGameState();
+	if (state == PAUSED || state == DEATH) return;
+
+	wheels[static_cast<size_t>(GameClock::GAME)].advance(deltaTime, pending);
+
+	if (!Game::freeze.isEffectActive()) wheels[static_cast<size_t>(GameClock::WORLD)].advance(deltaTime, pending);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#ifndef TIMERS_H
+#define TIMERS_H
+
+#include <vector>
+#include <array>
+#include <unordered_set>
+#include <functional>
+#include <cstdint>
+
+using namespace std;
+
+// GAME stops while paused or dead, WORLD also stops while everything is frozen
+enum class GameClock : uint8_t {
+	GAME,
+	WORLD,
+	COUNT
+};
+
+struct Timer {
+	uint32_t id;
+	uint64_t deadline;
+	function<void()> callback;
+};
+
+// Four levels of 64 slots, a timer sits in the level of the highest tick group it differs from now in
+// and drops a level each time that group comes around, so scheduling and firing are O(1)
+class TimerWheel {
+public:
+	static constexpr float tickLength = 1.0f / 120.0f;
+
+	void schedule(const uint32_t& id, const float& delay, const function<void()>& callback);
+	void advance(const float& deltaTime, unordered_set<uint32_t>& pending);
+
+	const double now() const;
+private:
+	static const uint8_t levelBits = 6;
+	static const uint8_t slotCount = 1 << levelBits;
+	static const uint8_t levelCount = 4;
+
+	void insert(Timer&& timer);
+	void cascade(const uint8_t& level);
+
+	array<array<vector<Timer>, slotCount>, levelCount> levels;
+	uint64_t tick = 0;
+	float remainder = 0.0f;
+};
+
+// One wheel per clock, ids are shared so a timer can be cancelled without knowing its clock
+class Timers {
+public:
+	static const uint32_t after(const float& delay, const function<void()>& callback, const GameClock& clock = GameClock::GAME);
+	static void cancel(const uint32_t& id);
+	static const bool isPending(const uint32_t& id);
+
+	static const double now(const GameClock& clock);
+
+	static void update(const float& deltaTime);
+private:
+	static array<TimerWheel, static_cast<size_t>(GameClock::COUNT)> wheels;
+	static unordered_set<uint32_t> pending;
+	static uint32_t nextId;
+};
+
+#endif
@@ -1,24 +1,28 @@
 #include "Tower.h"
 #include "WindowBox.h"
-#include "EnemyBullet.h"
+#include "Patterns.h"
 #include "Pickup.h"
+#include "Shockwaves.h"
 
 const float shootTime = 0.5f;
 const int counter = 5;
+const float range = 900.0f;
 
 Tower::Tower() : Enemy(10000.0f + 200.0f * floor(Score::getScore() / FileMenager::screenData.game_next_level_spike), physics::getRandomFloatValue(FileMenager::enemiesData.asteroid_speed), getSprite(Sprites::TOWER)),
-shoot(shootTime, false),
-changePosition(0.0f, false),
-shootCounter(counter)
+changePosition(0.0f, false, GameClock::WORLD)
 {
 	scaleSprite(spriteInfo.sprite, spriteInfo.hitboxSize, spriteInfo.spriteSize);
 
 	drawHitboxes();
 
 	angle = 0;
+
+	setLayer(LAYER_ENEMY);
+
+	Behaviours::start(this, attack());
 }
 
-void Tower::render(RenderWindow& window)
+void Tower::render(RenderList& window)
 {
 	Enemy::render(window);
 }
@@ -29,8 +33,6 @@ void Tower::update(float deltaTime)
 
 	if (Game::freeze.isEffectActive()) return;
 
-	shoot.updateEffectDuration(deltaTime);
-	changePosition.updateEffectDuration(deltaTime);
 	float radius = 0.3f;
 	float circularX = cos(changePosition.getEffectDuration()) * radius;
 	float circularY = sin(changePosition.getEffectDuration()) * radius;
@@ -39,30 +41,27 @@ void Tower::update(float deltaTime)
 	position.x = originalPosition.x + circularX;
 	position.y = originalPosition.y + circularY;
 
-	if (shootCounter == counter) {
-		angle += 45;
-		shootCounter = 0;
-	}
+	setSpriteFullCycle(deltaTime);
+}
 
-	if (!shoot.isEffectActive()) {
-		shoot.startEffect(shootTime);
-		shootCounter++;
+// A cross of bullets, it turns by 45 degrees every few volleys and the tower idles while the player is far away
+BehaviourTask Tower::attack()
+{
+	size_t volley = 0;
 
-		for (int i = 0; i < 4; ++i) {
-			float angle = i * 90.0f + this->angle;
-			float radianAngle = angle * (physics::getPI() / 180.0f);
-			float directionX = cos(radianAngle);
-			float directionY = sin(radianAngle);
+	for (;;) {
+		co_await behaviour::untilPlayerInRange(range);
 
-			float bulletAngle = atan2(directionY, directionX) * 180 / physics::getPI();
+		angle += 45;
 
-			Game::addEntity(new EnemyBullet(position, { directionX, directionY }, bulletAngle, Sprites::ENEMY_BULLET));
-		}
+		for (int shot = 0; shot < counter; shot++) {
+			Patterns::emit(Faction::ENEMY, Patterns::get("towerCross"), position, angle, volley++);
 
-		SoundData::play(Sounds::ALIEN_SHOOT1);
-	}
+			SoundData::play(Sounds::ALIEN_SHOOT1);
 
-	setSpriteFullCycle(deltaTime);
+			co_await behaviour::seconds(shootTime);
+		}
+	}
 }
 
 void Tower::collisionDetection() {}
@@ -70,6 +69,7 @@ void Tower::collisionDetection() {}
 void Tower::destroy()
 {
 	Game::replaceEntity(this, new Explosion(position, size));
+	Shockwaves::emit(position, size * 3, 300.0f, Player::playerStats.bulletDamage * 3.0f);
 
 	Game::addEntity(new Pickup(position));
 
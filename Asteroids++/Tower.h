@@ -3,6 +3,7 @@
 #define TOWER_H
 
 #include "Enemy.h"
+#include "Behaviours.h"
 #include "Entity.h"
 
 using namespace sf;
@@ -13,15 +14,15 @@ class Tower : public Enemy
 public:
 	Tower();
 
-	void render(RenderWindow& window) override;
+	void render(RenderList& window) override;
 	void update(float deltaTime) override;
 	void collisionDetection() override;
 	void destroy() override;
 
 private:
-	Effect shoot;
+	BehaviourTask attack();
+
 	Effect changePosition;
-	int shootCounter;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "Tweens.h"
+#include "Entity.h"
+#include <algorithm>
+
+vector<Track> Tweens::tracks;
+uint32_t Tweens::nextId = 1;
+
+const uint32_t Tweens::colour(Entity* owner, const Color& from, const Color& to, const float& duration, const GameClock& clock)
+{
+	owner->spriteInfo.sprite.setColor(from);
+
+	return add({ 0, owner, TrackKind::COLOUR, clock, Timers::now(clock), -1.0, duration, from, to, {}, {} });
+}
+
+// Pulls the owner towards the target harder as the track goes on, so its own movement still counts early on
+const uint32_t Tweens::position(Entity* owner, const Vector2f& target, const float& duration, const float& delay, const function<void()>& onDone, const GameClock& clock)
+{
+	return add({ 0, owner, TrackKind::POSITION, clock, Timers::now(clock) + delay, -1.0, duration, {}, {}, target, onDone });
+}
+
+const uint32_t Tweens::add(Track&& track)
+{
+	track.id = nextId++;
+
+	const auto same = ranges::find_if(tracks, [&](const Track& other) { return other.owner == track.owner && other.kind == track.kind; });
+
+	if (same != tracks.end()) *same = move(track);
+	else tracks.push_back(move(track));
+
+	return nextId - 1;
+}
+
+void Tweens::cancel(const uint32_t& id)
+{
+	erase_if(tracks, [&](const Track& track) { return track.id == id; });
+}
+
+void Tweens::update()
+{
+	vector<function<void()>> finished;
+
+	for (size_t i = 0; i < tracks.size();) {
+		if (tracks[i].owner->isActive() && !step(tracks[i])) {
+			i++;
+			continue;
+		}
+
+		if (tracks[i].owner->isActive() && tracks[i].onDone) finished.push_back(move(tracks[i].onDone));
+
+		tracks[i] = move(tracks.back());
+		tracks.pop_back();
+	}
+
+	// Run after the sweep so a callback can start the next track on the same entity
+	for (auto& onDone : finished) onDone();
+}
+
+void Tweens::clear()
+{
+	tracks.clear();
+}
+
+const bool Tweens::step(Track& track)
+{
+	// A pull isn't idempotent, so nothing is applied again while the clock stands still
+	const auto now = Timers::now(track.clock);
+	if (now == track.stepped) return false;
+
+	const auto elapsed = float(now - track.start);
+	if (elapsed < 0.0f) return false;
+
+	track.stepped = now;
+
+	const auto progress = track.duration > 0.0f ? min(elapsed / track.duration, 1.0f) : 1.0f;
+
+	auto& owner = *track.owner;
+
+	switch (track.kind) {
+	case TrackKind::COLOUR:
+	{
+		const auto& from = track.fromColour;
+		const auto& to = track.toColour;
+
+		owner.spriteInfo.sprite.setColor(Color(
+			Uint8(from.r + progress * (to.r - from.r)),
+			Uint8(from.g + progress * (to.g - from.g)),
+			Uint8(from.b + progress * (to.b - from.b)),
+			Uint8(from.a + progress * (to.a - from.a))
+		));
+		break;
+	}
+	case TrackKind::POSITION:
+		owner.position += (track.target - owner.position) * progress;
+		break;
+	}
+
+	return progress >= 1.0f;
+}
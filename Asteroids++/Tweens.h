@@ -0,0 +1,57 @@
+#pragma once
+#ifndef TWEENS_H
+#define TWEENS_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include "Timers.h"
+
+using namespace sf;
+using namespace std;
+
+class Entity;
+
+enum class TrackKind : uint8_t {
+	COLOUR,
+	POSITION
+};
+
+// One interpolated value on an entity, start is on the track's clock so a delay is just a later start
+struct Track {
+	uint32_t id;
+	Entity* owner;
+	TrackKind kind;
+	GameClock clock;
+
+	double start;
+	double stepped;
+	float duration;
+
+	Color fromColour;
+	Color toColour;
+	Vector2f target;
+
+	function<void()> onDone;
+};
+
+// Colour and position tweens stepped with the simulation, an entity has at most one track of each kind
+class Tweens {
+public:
+	static const uint32_t colour(Entity* owner, const Color& from, const Color& to, const float& duration, const GameClock& clock = GameClock::GAME);
+	static const uint32_t position(Entity* owner, const Vector2f& target, const float& duration, const float& delay, const function<void()>& onDone, const GameClock& clock = GameClock::GAME);
+	static void cancel(const uint32_t& id);
+
+	static void update();
+	static void clear();
+private:
+	static const uint32_t add(Track&& track);
+
+	static const bool step(Track& track);
+
+	static vector<Track> tracks;
+	static uint32_t nextId;
+};
+
+#endif
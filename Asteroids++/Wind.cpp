@@ -1,5 +1,6 @@
 #include "Wind.h"
 #include "WindowBox.h"
+#include "QualityGovernor.h"
 
 Wind::Wind() : EventHandler(VertexArray(Lines, 400)),
 windSpeed(200.0f),
@@ -36,7 +37,9 @@ void Wind::update(float deltaTime)
 	if (Game::freeze.isEffectActive() || Game::getGameState() == PAUSED)
 		return;
 
-	for (size_t i = 0; i < particles.getVertexCount() - 1; i += 2)
+	const auto streaks = QualityGovernor::getWindStreaks(particles.getVertexCount());
+
+	for (size_t i = 0; i + 1 < streaks; i += 2)
 	{
 		particles[i].position += velocity * windSpeed * deltaTime;
 		particles[i + 1].position += velocity * windSpeed * deltaTime;
@@ -54,7 +57,7 @@ void Wind::update(float deltaTime)
 		return;
 	}
 
-	for (size_t i = 0; i < particles.getVertexCount() - 1; i += 2)
+	for (size_t i = 0; i + 1 < streaks; i += 2)
 	{
 		particles[i].position += velocity * windSpeed * windLevel * deltaTime + (wind.getEffectDuration() > fullWindDuration - lineHeight ? velocity : Vector2f(0, 0));
 		particles[i + 1].position += velocity * windSpeed * windLevel * deltaTime + (wind.getEffectDuration() < lineHeight ? velocity : Vector2f(0, 0));
@@ -186,17 +189,15 @@ void Wind::forceWind(const float& duration, const float& windLevel, const Vector
 	Game::setGameState(WIND);
 }
 
-void Wind::init(const float& deltaTime, RenderWindow& window) {
+void Wind::init(const float& deltaTime, RenderList& window) {
 	activateWind(physics::getRandomFloatValue(FileMenager::timingsData.default_wind_time, 0.75f) + Player::playerStats.time, physics::getRandomFloatValue(3.0f), physics::getRandomDirection());
 
 	update(deltaTime);
 
-	if (Game::freeze.isEffectActive()) {
-		Game::freeze.updateEffectDuration(deltaTime);
-		stopWind();
-	}
+	if (Game::freeze.isEffectActive()) stopWind();
 
-	render(window);
+	const auto streaks = QualityGovernor::getWindStreaks(particles.getVertexCount());
+	if (streaks > 0) window.draw(&particles[0], streaks, Lines);
 }
 
 bool Wind::isActive(){
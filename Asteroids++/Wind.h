@@ -14,7 +14,7 @@ class Wind : public EventHandler {
 public:
     Wind();
 
-    void init(const float& deltaTime, RenderWindow& window) override;
+    void init(const float& deltaTime, RenderList& window) override;
     bool isActive();
     void update(float deltaTime) override;
     const EntityType getEntityType() override;  
@@ -10,11 +10,15 @@
 #include "Wind.h"
 #include "DeathScreen.h"
 #include "GameFrame.h"
+#include "Input.h"
+#include "InputLatency.h"
+#include "FramePacer.h"
+#include "QualityGovernor.h"
+#include "RenderThread.h"
 
 VideoMode WindowBox::videoMode{};
 DeathScreen* WindowBox::deathScreen = nullptr;
 RenderWindow WindowBox::window{};
-bool WindowBox::isKeyPressed{ false };
 
 WindowBox::WindowBox() : counter(0) {}
 
@@ -27,7 +31,9 @@ void WindowBox::displayWindow() {
     //videoMode = VideoMode::getDesktopMode();
 
     window.create(videoMode, "Asteroids++", Style::None);
-    window.setFramerateLimit(FileMenager::screenData.framerate);
+    const auto lateSampling = FileMenager::screenData.input_late_sampling != 0;
+
+    FramePacer::init(window, static_cast<PacingMode>(FileMenager::screenData.frame_pacing_mode), FileMenager::screenData.framerate);
 
     Image icon;
     if (!icon.loadFromFile("assets/favicon.png")) {
@@ -40,30 +46,39 @@ void WindowBox::displayWindow() {
     Game::setGameState(MENU_LOADING);
     Game::init();
 
+    RenderThread::start(window, FileMenager::screenData.render_thread != 0);
+
     Clock clock;
 
     while (window.isOpen()) {
-        Event e{};
+        InputLatency::mark(FrameMark::FRAME_START);
+
+        if (lateSampling) FramePacer::waitUntil(FramePacer::getNextDeadline() - InputLatency::getEstimatedWorkTime());
 
-        while (window.pollEvent(e)) {
-            if(e.type == Event::Closed || (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)) close();
+        Input::poll(window);
+        InputLatency::mark(FrameMark::INPUT_SAMPLED);
 
-            Game::navigate(e);
+        const auto& input = Input::getSnapshot();
 
-            if (e.type == Event::KeyReleased) {
-                isKeyPressed = false;
-            }
-        }
+        if (input.closed || input.isPressed(Action::EXIT)) close();
+
+        Game::navigate(input);
 
         float deltaTime = clock.restart().asSeconds();
 
-        window.clear();
+        auto& frame = RenderThread::getFrame();
+
+        Game::runCurrentPage(deltaTime, frame);
+        InputLatency::mark(FrameMark::SIMULATION_DONE);
 
-        Game::runCurrentPage(deltaTime, window);
+        deathScreen->init(deltaTime, frame);
+        InputLatency::mark(FrameMark::RENDER_SUBMITTED);
+        InputLatency::endFrame();
 
-        deathScreen->init(deltaTime, window);
+        RenderThread::submit();
+        QualityGovernor::update(InputLatency::getSubmittedFrame().getDuration(FrameMark::INPUT_SAMPLED, FrameMark::RENDER_SUBMITTED));
 
-        window.display();
+        FramePacer::endFrame();
     }
 }
 
@@ -78,5 +93,6 @@ void WindowBox::close()
     SoundData::play(Sounds::GOODBYE);
     this_thread::sleep_for(chrono::milliseconds(1000));
 
+    RenderThread::stop();
     window.close();
 }
@@ -14,8 +14,6 @@ public:
 	static void begin();
 
 	static void close();
-
-	static bool isKeyPressed;
 private:
 	int counter;
 
@@ -5,6 +5,9 @@
 #include "WindowBox.h"
 #include "TextField.h"
 #include "Game.h"
+#include "Input.h"
+#include "JobSystem.h"
+#include "Patterns.h"
 
 using namespace sf;
 using namespace std;
@@ -15,6 +18,9 @@ int main()
     fileMenager.setFileName("config.txt");
     fileMenager.setDataFromFile();
 
+    Input::init();
+    JobSystem::init(FileMenager::screenData.worker_threads);
+
     TextField::loadFont();
 
     SoundData sounds;
@@ -23,7 +29,11 @@ int main()
     SpriteData sprite;
     sprite.loadAllSprites();
 
+    Patterns::loadAllPatterns();
+
     WindowBox window;
 
     window.displayWindow();
+
+    JobSystem::shutdown();
 }
\ No newline at end of file